@@ -33,6 +33,10 @@ macro(global_set_flags)
         add_definitions(-DZERO_COPY)
     endif()
 
+    if (ENABLE_V4L2_CAPTURE_REACTOR)
+        add_definitions(-DV4L2_CAPTURE_REACTOR -DV4L2_CAPTURE_REACTOR_THREADS=${V4L2_CAPTURE_REACTOR_THREADS})
+    endif()
+
     if (BUILD_EASYLOGGINGPP)
         add_definitions(-DBUILD_EASYLOGGINGPP)
     endif()
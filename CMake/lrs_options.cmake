@@ -4,6 +4,8 @@ option(BUILD_GRAPHICAL_EXAMPLES "Build graphical examples and tools. Implies BUI
 option(BUILD_GLSL_EXTENSIONS "Build GLSL extensions API" ON)
 option(BUILD_WITH_OPENMP "Use OpenMP" OFF)
 option(ENABLE_ZERO_COPY "Enable zero copy functionality" OFF)
+option(ENABLE_V4L2_CAPTURE_REACTOR "Capture all the V4L2 streams from shared epoll threads rather than a thread per stream. Linux only" OFF)
+set(V4L2_CAPTURE_REACTOR_THREADS 1 CACHE STRING "Number of threads of the V4L2 capture reactor")
 option(BUILD_WITH_TM2 "Build with support for Intel TM2 tracking device" ON)
 option(BUILD_EASYLOGGINGPP "Build EasyLogging++ as a part of the build" ON)
 option(BUILD_WITH_STATIC_CRT "Build with static link CRT" ON)
@@ -48,6 +48,16 @@ int rs2_device_list_contains(const rs2_device_list* info_list, const rs2_device*
 */
 rs2_device* rs2_create_device(const rs2_device_list* info_list, int index, rs2_error** error);
 
+/**
+* Creates all the devices of a list at once, each on its own thread, so that several cameras are ready in about the time of one.
+* Returns once every device is created, or none of them when any fails.
+* \param[in]  info_list the list containing the devices to create
+* \param[out] devices   Receives the devices, in the order of the list, each should be released by rs2_delete_device
+* \param[in]  count     The number of devices of the list, the size of devices
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_create_devices(const rs2_device_list* info_list, rs2_device** devices, int count, rs2_error** error);
+
 /**
 * Delete RealSense device
 * \param[in]  device    Realsense device to delete
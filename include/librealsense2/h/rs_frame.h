@@ -191,6 +191,7 @@ void rs2_keep_frame(rs2_frame* frame);
 /**
 * When called on Points frame type, this method returns a pointer to an array of 3D vertices of the model
 * The coordinate system is: X right, Y up, Z away from the camera. Units: Meters
+* Available for RS2_FORMAT_XYZ32F points, see rs2_get_frame_packed_vertices for the other vertex formats
 * \param[in] frame       Points frame
 * \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
 * \return                Pointer to an array of vertices, lifetime is managed by the frame
@@ -209,6 +210,7 @@ void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* tex
 /**
 * When called on Points frame type, this method returns a pointer to an array of texture coordinates per vertex
 * Each coordinate represent a (u,v) pair within [0,1] range, to be mapped to texture image
+* Available for RS2_FORMAT_XYZ32F points, see rs2_get_frame_packed_texture_coordinates for the other vertex formats
 * \param[in] frame       Points frame
 * \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
 * \return                Pointer to an array of texture coordinates, lifetime is managed by the frame
@@ -223,6 +225,51 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 */
 int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error);
 
+/**
+* When called on a motion frame, this method returns the number of samples of a batched frame, see RS2_OPTION_MOTION_BATCH_SIZE.
+* The data of a batched frame is an array of rs2_motion_sample, the frame timestamp and motion data are those of the first sample
+* \param[in] frame       Motion frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Number of samples, 0 for a frame of a single sample
+*/
+int rs2_get_frame_motion_samples_count(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on Points frame type, this method returns for each vertex the index of the depth pixel it was deprojected from
+* Available only for sparse pointclouds produced with pixel indices (RS2_OPTION_SPARSE_OUTPUT set to 2)
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to an array of rs2_get_frame_points_count indices, or null when the frame carries none. Lifetime is managed by the frame
+*/
+const int* rs2_get_frame_pixel_indices(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on Points frame type, this method returns a pointer to the vertices in the format of the frame stream profile:
+* three floats per vertex for RS2_FORMAT_XYZ32F, three int16_t for RS2_FORMAT_XYZ16 (multiply by rs2_get_frame_vertex_scale
+* to get meters) or three IEEE half precision floats for RS2_FORMAT_XYZ16F
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to an array of vertices, lifetime is managed by the frame
+*/
+const void* rs2_get_frame_packed_vertices(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on Points frame type, this method returns a pointer to the texture coordinates in the format of the frame stream profile:
+* two floats per vertex for RS2_FORMAT_XYZ32F, otherwise two uint16_t normalized to the [0,1] range (65535 maps to 1)
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to an array of texture coordinates, lifetime is managed by the frame
+*/
+const void* rs2_get_frame_packed_texture_coordinates(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on Points frame type, this method returns the size of a RS2_FORMAT_XYZ16 vertex unit
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Meters per vertex unit, 1 for the floating point vertex formats
+*/
+float rs2_get_frame_vertex_scale(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Returns the stream profile that was used to start the stream of this frame
 * \param[in] frame       frame reference, owned by the user
@@ -84,6 +84,17 @@ extern "C" {
         RS2_OPTION_LED_POWER, /**< Power of the LED (light emitting diode), with 0 meaning LED off*/
         RS2_OPTION_ZERO_ORDER_ENABLED, /**< Toggle Zero-Order mode */
         RS2_OPTION_ENABLE_MAP_PRESERVATION, /**< Preserve previous map when starting */
+        RS2_OPTION_SPARSE_OUTPUT, /**< Emit only the valid points of a pointcloud: 0 - all pixels, 1 - valid points, 2 - valid points with their pixel indices */
+        RS2_OPTION_VERTEX_FORMAT, /**< Vertex format of a pointcloud: 0 - XYZ32F, 1 - XYZ16 fixed point, 2 - XYZ16F half precision */
+        RS2_OPTION_VERTEX_SCALE, /**< Meters per unit of XYZ16 pointcloud vertices */
+        RS2_OPTION_OCCLUSION_DECIMATION, /**< Size of the square texel cells the exhaustive occlusion removal of a pointcloud works on */
+        RS2_OPTION_ROI_MIN_X, /**< Left edge of the region of interest a processing block computes, as a fraction of the frame width */
+        RS2_OPTION_ROI_MIN_Y, /**< Top edge of the region of interest a processing block computes, as a fraction of the frame height */
+        RS2_OPTION_ROI_MAX_X, /**< Right edge of the region of interest a processing block computes, as a fraction of the frame width */
+        RS2_OPTION_ROI_MAX_Y, /**< Bottom edge of the region of interest a processing block computes, as a fraction of the frame height */
+        RS2_OPTION_ROI_CROP, /**< Crop the output frame of a processing block to its region of interest */
+        RS2_OPTION_MOTION_BATCH_SIZE, /**< Maximal number of IMU samples delivered per motion frame, 1 delivers every sample in its own frame */
+        RS2_OPTION_MOTION_BATCH_PERIOD, /**< Maximal time span in milliseconds of the IMU samples of a batched motion frame, 0 for no time limit */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
@@ -140,6 +151,16 @@ extern "C" {
     */
     float rs2_get_option(const rs2_options* options, rs2_option option, rs2_error** error);
 
+    /**
+    * read the values of several options at once, faster than reading them one by one as the device is powered once for all of them
+    * \param[in] options      the options container
+    * \param[in] option_ids   ids of the options to be queried
+    * \param[out] values      receives the value of each option, in the order of option_ids
+    * \param[in] count        number of options to be queried
+    * \param[out] error       if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_get_options_values(const rs2_options* options, const rs2_option* option_ids, float* values, int count, rs2_error** error);
+
     /**
     * write new value to sensor option
     * \param[in] sensor     the RealSense sensor
@@ -18,6 +18,17 @@ extern "C" {
 #include "rs_sensor.h"
 #include "rs_option.h"
 
+/** \brief Performance counters of a processing block, collected while enabled by rs2_enable_processing_block_stats */
+typedef struct rs2_processing_block_stats
+{
+    unsigned long long calls;           /**< Number of frames the block was invoked with */
+    unsigned long long frames_dropped;  /**< Invocations that failed or delivered no output frame */
+    unsigned long long allocated_bytes; /**< Total size of the output frames the block allocated */
+    float              mean_latency_ms; /**< Mean processing time of an invocation, in milliseconds */
+    float              p50_latency_ms;  /**< Median processing time over the latest invocations, in milliseconds */
+    float              p99_latency_ms;  /**< 99th percentile of the processing time over the latest invocations, in milliseconds */
+} rs2_processing_block_stats;
+
 /**
 * Creates Depth-Colorizer processing block that can be used to quickly visualize the depth data
 * This block will accept depth frames as input and replace them by depth frames with format RGB8
@@ -243,6 +254,68 @@ rs2_processing_block* rs2_create_rates_printer_block(rs2_error** error);
 */
 rs2_processing_block* rs2_create_zero_order_invalidation_block(rs2_error** error);
 
+/**
+* Creates a block applying a chain of depth post-processing filters in a single pass, with a single output frame allocation.
+* The filters keep their own options and state, and must be given in the decimation, depth to disparity, spatial, temporal,
+* disparity to depth and hole filling order, each of them optional. The output is the same as processing the frame with
+* each of the filters in turn
+* \param[in] filters   Filter blocks to apply, created by the rs2_create_*_filter_block and rs2_create_disparity_transform_block functions
+* \param[in] count     Number of filters
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return              depth post-processing block
+*/
+rs2_processing_block* rs2_create_depth_post_processing_block(rs2_processing_block** filters, int count, rs2_error** error);
+
+/**
+* Creates a processing graph. The graph runs the blocks added to it as a dependency graph over every frame: blocks that
+* do not depend on each other run concurrently, and the output is a composite of the frames produced by the blocks
+* nothing depends on. Once max_in_flight frames are being processed, further frames wait for one of them to complete
+* \param[in] max_in_flight Maximal number of frames processed at once
+* \param[out] error        If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                  processing graph block
+*/
+rs2_processing_block* rs2_create_processing_graph(int max_in_flight, rs2_error** error);
+
+/**
+* Adds a block to a processing graph. The block consumes the output of the given graph nodes, or the graph input when there are none.
+* The block output is redirected to the graph
+* \param[in] graph         Processing graph created by rs2_create_processing_graph
+* \param[in] block         Processing block to add
+* \param[in] inputs        Nodes the block depends on, as returned by previous calls
+* \param[in] inputs_count  Number of nodes the block depends on
+* \param[out] error        If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                  graph node of the block
+*/
+int rs2_processing_graph_add_block(rs2_processing_block* graph, rs2_processing_block* block, const int* inputs, int inputs_count, rs2_error** error);
+
+/**
+* Creates a processing batch, for offline processing of many frames. The batch runs a sequence of stages over the frames
+* on a set of worker threads: parallel stages process several frames at once, ordered stages process the frames one at a
+* time in their invocation order, and the frames are delivered in their invocation order.
+* Invocations return once the frame is queued, unless the batch is full
+* \param[in] threads      Number of worker threads, all the cores when 0
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                 processing batch block
+*/
+rs2_processing_block* rs2_create_processing_batch(int threads, rs2_error** error);
+
+/**
+* Appends a stage to a processing batch. The output of the stage blocks is redirected to the batch
+* \param[in] batch        Processing batch created by rs2_create_processing_batch
+* \param[in] blocks       Blocks of the stage. A parallel stage processes each frame on one of its blocks, which should be configured alike
+* \param[in] blocks_count Number of blocks of the stage, a single block for an ordered stage
+* \param[in] ordered      Non-zero for a stage processing the frames in order, for blocks keeping state between frames such as the temporal filter
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_batch_add_stage(rs2_processing_block* batch, rs2_processing_block** blocks, int blocks_count, int ordered, rs2_error** error);
+
+/**
+* Waits for the frames invoked on a processing batch so far to be delivered
+* \param[in] batch        Processing batch created by rs2_create_processing_batch
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_batch_flush(rs2_processing_block* batch, rs2_error** error);
+
 /**
 * Retrieve processing block specific information, like name.
 * \param[in]  block     The processing block
@@ -270,6 +343,37 @@ int rs2_supports_processing_block_info(const rs2_processing_block* block, rs2_ca
  */
 int rs2_is_processing_block_extendable_to(const rs2_processing_block* block, rs2_extension extension_type, rs2_error** error);
 
+/**
+* Start or stop collecting the performance counters of a processing block. Collection is disabled by default
+* \param[in] block     processing block
+* \param[in] enable    non-zero to collect the counters
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_processing_block_stats(rs2_processing_block* block, int enable, rs2_error** error);
+
+/**
+* Retrieve the performance counters of a processing block
+* \param[in] block     processing block
+* \param[out] stats    the counters collected since the collection was enabled or reset
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_processing_block_stats(const rs2_processing_block* block, rs2_processing_block_stats* stats, rs2_error** error);
+
+/**
+* Reset the performance counters of a processing block
+* \param[in] block     processing block
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_reset_processing_block_stats(rs2_processing_block* block, rs2_error** error);
+
+/**
+* Retrieve the processing blocks a sensor currently runs internally to produce its streams, e.g. format conversions
+* \param[in] sensor    input sensor
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return              list of the processing blocks, to be released by rs2_delete_recommended_processing_blocks
+*/
+rs2_processing_block_list* rs2_get_sensor_processing_blocks(rs2_sensor* sensor, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
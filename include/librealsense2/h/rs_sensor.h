@@ -85,6 +85,8 @@ typedef enum rs2_format
     RS2_FORMAT_INZI            , /**< multi-planar Depth 16bit + IR 10bit.  */
     RS2_FORMAT_INVI            , /**< 8-bit IR stream.  */
     RS2_FORMAT_W10             , /**< Grey-scale image as a bit-packed array. 4 pixel data stream taking 5 bytes */
+    RS2_FORMAT_XYZ16           , /**< 16-bit fixed point 3D coordinates, in units of the frame vertex scale, with 16-bit normalized texture coordinates. */
+    RS2_FORMAT_XYZ16F          , /**< 16-bit half precision floating point 3D coordinates, with 16-bit normalized texture coordinates. */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
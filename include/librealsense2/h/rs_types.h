@@ -99,6 +99,13 @@ typedef struct rs2_vector
     float x, y, z;
 }rs2_vector;
 
+/** \brief Sample of a batched motion frame */
+typedef struct rs2_motion_sample
+{
+    rs2_vector value;       /**< Motion data, as in a motion frame of a single sample */
+    double     timestamp;   /**< Timestamp of the sample, in milliseconds in the timestamp domain of the frame */
+} rs2_motion_sample;
+
 /** \brief Quaternion used to represent rotation  */
 typedef struct rs2_quaternion
 {
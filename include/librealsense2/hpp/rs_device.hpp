@@ -603,6 +603,26 @@ return results;
             return device(dev);
         }
 
+        /**
+        * creates all the devices of the list at once, each on its own thread, returning when all of them are ready
+        * \return            the devices, in the order of the list
+        */
+        std::vector<device> create_devices() const
+        {
+            if (size() == 0)
+                return {};
+
+            rs2_error* e = nullptr;
+            std::vector<rs2_device*> devices(size());
+            rs2_create_devices(_list.get(), devices.data(), static_cast<int>(devices.size()), &e);
+            error::handle(e);
+
+            std::vector<device> results;
+            for (auto&& dev : devices)
+                results.push_back(device(std::shared_ptr<rs2_device>(dev, rs2_delete_device)));
+            return results;
+        }
+
         uint32_t size() const
         {
             rs2_error* e = nullptr;
@@ -774,6 +774,54 @@ namespace rs2
             return (const texture_coordinate*)res;
         }
 
+        /**
+        * Retrieve the depth pixel index of each vertex, available on sparse point clouds produced with pixel indices
+        * \return const int* - pointer of pixel indices, or nullptr when the frame carries none
+        */
+        const int* get_pixel_indices() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_pixel_indices(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
+        /**
+        * Retrieve the vertices in the format of the frame profile, see rs2_get_frame_packed_vertices
+        * \return const void* - pointer of the vertex data
+        */
+        const void* get_packed_vertices() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_packed_vertices(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
+        /**
+        * Retrieve the texture coordinates in the format of the frame profile, see rs2_get_frame_packed_texture_coordinates
+        * \return const void* - pointer of the texture coordinate data
+        */
+        const void* get_packed_texture_coordinates() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_packed_texture_coordinates(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
+        /**
+        * Retrieve the meters per unit of RS2_FORMAT_XYZ16 vertices
+        * \return float - vertex scale, 1 for the floating point vertex formats
+        */
+        float get_vertex_scale() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_vertex_scale(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
         size_t size() const
         {
             return _size;
@@ -872,6 +920,27 @@ namespace rs2
             auto data = reinterpret_cast<const float*>(get_data());
             return rs2_vector{ data[0], data[1], data[2] };
         }
+
+        /**
+        * Retrieve the number of samples of a batched motion frame, see RS2_OPTION_MOTION_BATCH_SIZE
+        * \return int - number of samples, 0 for a frame of a single sample
+        */
+        int get_samples_count() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_motion_samples_count(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
+        /**
+        * Retrieve the samples of a batched motion frame, in the order they were measured
+        * \return const rs2_motion_sample* - pointer to get_samples_count() samples
+        */
+        const rs2_motion_sample* get_motion_samples() const
+        {
+            return reinterpret_cast<const rs2_motion_sample*>(get_data());
+        }
     };
 
     class pose_frame : public frame
@@ -77,6 +77,20 @@ namespace rs2
             return res;
         }
 
+        /**
+        * read the values of several supported options at once, faster than reading them one by one
+        * \param[in] ids     options ids to be queried
+        * \return values of the options, in the order of ids
+        */
+        std::vector<float> get_options(const std::vector<rs2_option>& ids) const
+        {
+            std::vector<float> values(ids.size());
+            rs2_error* e = nullptr;
+            rs2_get_options_values(_options, ids.data(), values.data(), static_cast<int>(ids.size()), &e);
+            error::handle(e);
+            return values;
+        }
+
         /**
         * retrieve the available range of values of a supported option
         * \return option  range containing minimum and maximum values, step and default value
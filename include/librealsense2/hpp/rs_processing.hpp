@@ -327,6 +327,40 @@ namespace rs2
             error::handle(e);
             return result;
         }
+
+        /**
+        * Start or stop collecting the performance counters of the processing block, disabled by default
+        * \param[in] enable  whether to collect the counters
+        */
+        void enable_stats(bool enable = true)
+        {
+            rs2_error* e = nullptr;
+            rs2_enable_processing_block_stats(_block.get(), enable ? 1 : 0, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Retrieve the performance counters collected since they were enabled or reset
+        * \return            call count, dropped frames, allocated bytes and latency statistics of the block
+        */
+        rs2_processing_block_stats get_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_block_stats stats;
+            rs2_get_processing_block_stats(_block.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * Reset the performance counters of the processing block
+        */
+        void reset_stats()
+        {
+            rs2_error* e = nullptr;
+            rs2_reset_processing_block_stats(_block.get(), &e);
+            error::handle(e);
+        }
     protected:
         void register_simple_option(rs2_option option_id, option_range range) {
             rs2_error * e = nullptr;
@@ -351,7 +385,7 @@ namespace rs2
         */
         rs2::frame process(rs2::frame frame) const override
         {
-            invoke(frame);
+            invoke(std::move(frame));
             rs2::frame f;
             if (!_queue.poll_for_frame(&f))
                 throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
@@ -1066,5 +1100,156 @@ namespace rs2
             return block;
         }
     };
+
+    class depth_post_processing : public filter
+    {
+    public:
+        /**
+        * Create a block applying a chain of depth post-processing filters in a single pass.
+        * The filters keep their own options and state, and are given in the decimation, depth to disparity, spatial,
+        * temporal, disparity to depth and hole filling order, each of them optional.
+        * The output is the same as processing the frame with each of the filters in turn
+        * \param[in] filters - the filters to apply
+        */
+        depth_post_processing(const std::vector<filter>& filters) : filter(init(filters), 1) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init(const std::vector<filter>& filters)
+        {
+            std::vector<rs2_processing_block*> blocks;
+            for (auto&& f : filters)
+                blocks.push_back(f.get());
+
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_post_processing_block(blocks.data(), int(blocks.size()), &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    class processing_graph : public filter
+    {
+    public:
+        /**
+        * Create a processing graph, running the blocks added to it as a dependency graph over every frame.
+        * Blocks that do not depend on each other run concurrently, and the output is a composite of the frames
+        * produced by the blocks nothing depends on
+        * \param[in] max_in_flight - maximal number of frames processed at once, further frames wait for one of them to complete
+        */
+        processing_graph(int max_in_flight = 2) : filter(init(max_in_flight), 1) {}
+
+        /**
+        * Add a block to the graph. Its output is redirected to the graph
+        * \param[in] block  - the block to add
+        * \param[in] inputs - nodes the block consumes the output of, the graph input when empty
+        * return the graph node of the block
+        */
+        int add(const processing_block& block, const std::vector<int>& inputs = {})
+        {
+            rs2_error* e = nullptr;
+            auto node = rs2_processing_graph_add_block(get(), block.get(), inputs.data(), int(inputs.size()), &e);
+            error::handle(e);
+            return node;
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init(int max_in_flight)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_processing_graph(max_in_flight, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    class processing_batch : public processing_block
+    {
+    public:
+        /**
+        * Create a processing batch, running a sequence of stages over many frames on a set of worker threads.
+        * Invocations return once the frame is queued and the frames are delivered in their invocation order
+        * \param[in] threads - number of worker threads, all the cores when 0
+        */
+        processing_batch(int threads = 0) : processing_block(init(threads)) {}
+
+        /**
+        * Append a stage processing the frames one at a time in their invocation order, for the blocks keeping
+        * state between frames such as the temporal filter. The block output is redirected to the batch
+        * \param[in] block - the block of the stage
+        */
+        void add_ordered_stage(const processing_block& block)
+        {
+            rs2_error* e = nullptr;
+            auto ptr = block.get();
+            rs2_processing_batch_add_stage(get(), &ptr, 1, 1, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Append a stage processing several frames at once, each frame on one of the blocks, for the blocks keeping
+        * no state between frames. The blocks should be configured alike, their output is redirected to the batch
+        * \param[in] blocks - the blocks of the stage, as many frames as blocks are processed at once
+        */
+        template<class T>
+        void add_parallel_stage(const std::vector<T>& blocks)
+        {
+            std::vector<rs2_processing_block*> ptrs;
+            for (auto&& block : blocks)
+                ptrs.push_back(block.get());
+
+            rs2_error* e = nullptr;
+            rs2_processing_batch_add_stage(get(), ptrs.data(), int(ptrs.size()), 0, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Wait for the frames invoked so far to be delivered
+        */
+        void flush() const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_batch_flush(get(), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Process frames through the batch. The output is collected for the duration of the call, replacing
+        * the callback the batch was started with, and kept so that the frame pools of the blocks are not exhausted
+        * \param[in] frames - the frames to process
+        * return the processed frames, in order
+        */
+        std::vector<frame> process(const std::vector<frame>& frames)
+        {
+            std::vector<frame> results;
+            start([&results](frame f)
+            {
+                f.keep();
+                results.push_back(f);
+            });
+            for (auto&& f : frames)
+                invoke(f);
+            flush();
+            start([](frame) {});
+            return results;
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init(int threads)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_processing_batch(threads, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
@@ -241,6 +241,36 @@ namespace rs2
             return results;
         }
 
+        /**
+        * Retrieve the processing blocks the sensor currently runs to produce its streams, e.g. format conversions,
+        * to query their performance counters
+        * \return   the internal processing blocks of the open streams
+        */
+        std::vector<processing_block> get_processing_blocks() const
+        {
+            std::vector<processing_block> results{};
+
+            rs2_error* e = nullptr;
+            std::shared_ptr<rs2_processing_block_list> list(
+                rs2_get_sensor_processing_blocks(_sensor.get(), &e),
+                rs2_delete_recommended_processing_blocks);
+            error::handle(e);
+
+            auto size = rs2_get_recommended_processing_blocks_count(list.get(), &e);
+            error::handle(e);
+
+            for (auto i = 0; i < size; i++)
+            {
+                auto pb = std::shared_ptr<rs2_processing_block>(
+                    rs2_get_processing_block(list.get(), i, &e),
+                    rs2_delete_processing_block);
+                error::handle(e);
+                results.push_back(processing_block(pb));
+            }
+
+            return results;
+        }
+
         /**
         * get the recommended list of filters by the sensor
         * \return   list of filters that recommended by sensor
@@ -51,6 +51,8 @@ namespace librealsense
         auto video_stream_profile = dynamic_cast<video_stream_profile_interface*>(stream_profile);
         if (!video_stream_profile)
             throw librealsense::invalid_value_exception("stream must be video stream");
+        if (get_vertex_format() != RS2_FORMAT_XYZ32F)
+            throw librealsense::invalid_value_exception("only RS2_FORMAT_XYZ32F points can be exported");
         const auto vertices = get_vertices();
         const auto texcoords = get_texture_coordinates();
         std::vector<float3> new_vertices;
@@ -75,10 +77,32 @@ namespace librealsense
 
         const auto threshold = 0.05f;
         auto width = video_stream_profile->get_width();
+        auto height = video_stream_profile->get_height();
+
+        // A sparse point cloud holds only the valid points. Its faces are found through the pixel
+        // indices of the vertices, without them no faces are exported
+        std::vector<int> pixel_to_vertex;
+        bool sparse = get_vertex_count() != size_t(width * height);
+        if (sparse)
+        {
+            pixel_to_vertex.assign(width * height, -1);
+            if (auto indices = get_pixel_indices())
+            {
+                for (size_t i = 0; i < get_vertex_count(); ++i)
+                    pixel_to_vertex[indices[i]] = int(i);
+            }
+        }
+
         std::vector<std::tuple<int, int, int>> faces;
         for (int x = 0; x < width - 1; ++x) {
-            for (int y = 0; y < video_stream_profile->get_height() - 1; ++y) {
+            for (int y = 0; y < height - 1; ++y) {
                 auto a = y * width + x, b = y * width + x + 1, c = (y + 1)*width + x, d = (y + 1)*width + x + 1;
+                if (sparse)
+                {
+                    a = pixel_to_vertex[a]; b = pixel_to_vertex[b]; c = pixel_to_vertex[c]; d = pixel_to_vertex[d];
+                    if (a < 0 || b < 0 || c < 0 || d < 0)
+                        continue;
+                }
                 if (vertices[a].z && vertices[b].z && vertices[c].z && vertices[d].z
                     && abs(vertices[a].z - vertices[b].z) < threshold && abs(vertices[a].z - vertices[c].z) < threshold
                     && abs(vertices[b].z - vertices[d].z) < threshold && abs(vertices[c].z - vertices[d].z) < threshold)
@@ -141,7 +165,24 @@ namespace librealsense
 
     size_t points::get_vertex_count() const
     {
-        return data.size() / (sizeof(float3) + sizeof(int2));
+        return data.size() / get_point_size(get_vertex_format());
+    }
+
+    rs2_format points::get_vertex_format() const
+    {
+        auto stream = get_stream();
+        return stream ? stream->get_format() : RS2_FORMAT_XYZ32F;
+    }
+
+    byte* points::get_vertex_data()
+    {
+        get_frame_data(); // call GetData to ensure data is in main memory
+        return data.data();
+    }
+
+    byte* points::get_texture_coordinate_data()
+    {
+        return get_vertex_data() + get_vertex_count() * get_vertex_size(get_vertex_format());
     }
 
     float2* points::get_texture_coordinates()
@@ -152,6 +193,17 @@ namespace librealsense
         return ijs;
     }
 
+    void points::resize(size_t vertex_count)
+    {
+        if (vertex_count >= get_vertex_count()) return;
+
+        // Texture coordinates follow the vertices, move the ones kept right after the remaining vertices
+        auto format = get_vertex_format();
+        auto ijs = get_texture_coordinate_data();
+        memmove(get_vertex_data() + vertex_count * get_vertex_size(format), ijs, vertex_count * get_texture_coordinate_size(format));
+        data.resize(vertex_count * get_point_size(format));
+    }
+
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
@@ -242,6 +294,9 @@ namespace librealsense
 
     int frame::get_frame_data_size() const
     {
+        if (on_release.get_data() && on_release.get_size())
+            return static_cast<int>(on_release.get_size());
+
         return data.size();
     }
 
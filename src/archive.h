@@ -39,6 +39,7 @@ namespace librealsense
         bool                is_blocking = false; // when running from recording, this bit indicates 
                                                  // if the recorder was configured to realtime mode or not
                                                  // if true, this will force any queue receiving this frame not to drop it
+        uint32_t            motion_samples = 0; // number of rs2_motion_sample a batched motion frame holds, 0 for a single sample
 
         frame_additional_data() {};
 
@@ -147,6 +148,9 @@ namespace librealsense
         void release() override;
         void keep() override;
 
+        // The frame is observed through a single reference and owns its data, whose holder may then modify it in place
+        bool is_exclusive() const { return ref_count == 1 && !_kept && !on_release.get_data(); }
+
         frame_interface* publish(std::shared_ptr<archive_interface> new_owner) override;
         void unpublish() override {}
         void attach_continuation(frame_continuation&& continuation) override { on_release = std::move(continuation); }
@@ -185,6 +189,33 @@ namespace librealsense
         void export_to_ply(const std::string& fname, const frame_holder& texture);
         size_t get_vertex_count() const;
         float2* get_texture_coordinates();
+
+        // Vertices are stored in the format of the frame stream: RS2_FORMAT_XYZ32F with float texture coordinates,
+        // or RS2_FORMAT_XYZ16 / RS2_FORMAT_XYZ16F (16-bit fixed point / half precision) with normalized 16-bit texture coordinates
+        rs2_format get_vertex_format() const;
+        static size_t get_vertex_size(rs2_format format) { return format == RS2_FORMAT_XYZ32F ? sizeof(float3) : 3 * sizeof(uint16_t); }
+        static size_t get_texture_coordinate_size(rs2_format format) { return format == RS2_FORMAT_XYZ32F ? sizeof(float2) : 2 * sizeof(uint16_t); }
+        static size_t get_point_size(rs2_format format) { return get_vertex_size(format) + get_texture_coordinate_size(format); }
+
+        // Raw vertex and texture coordinate storage, valid for every vertex format
+        byte* get_vertex_data();
+        byte* get_texture_coordinate_data();
+
+        // Meters per unit of RS2_FORMAT_XYZ16 vertices
+        float get_vertex_scale() const { return _vertex_scale; }
+        void set_vertex_scale(float scale) { _vertex_scale = scale; }
+
+        // Keep only the first vertex_count vertices and texture coordinates, used for sparse point clouds.
+        // The buffer capacity is kept so the frame can be recycled for a full point cloud
+        void resize(size_t vertex_count);
+
+        // Depth pixel index of every vertex, nullptr unless set for a sparse point cloud
+        const int* get_pixel_indices() const { return _pixel_indices.empty() ? nullptr : _pixel_indices.data(); }
+        void set_pixel_indices(const int* indices, size_t count) { _pixel_indices.assign(indices, indices + count); }
+
+    private:
+        std::vector<int> _pixel_indices;
+        float _vertex_scale = 1.f;
     };
 
     MAP_EXTENSION(RS2_EXTENSION_POINTS, librealsense::points);
@@ -453,6 +484,8 @@ namespace librealsense
     public:
         motion_frame() : frame()
         {}
+
+        uint32_t get_samples_count() const { return additional_data.motion_samples; }
     };
 
     MAP_EXTENSION(RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame);
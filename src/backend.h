@@ -325,6 +325,7 @@ namespace librealsense
 #pragma pack(pop)
 
         typedef std::function<void(const sensor_data&)> hid_callback;
+        typedef std::function<void(const sensor_data* reports, size_t count)> hid_batch_callback;
 
         class hid_device
         {
@@ -339,6 +340,16 @@ namespace librealsense
             virtual std::vector<uint8_t> get_custom_report_data(const std::string& custom_sensor_name,
                                                                 const std::string& report_name,
                                                                 custom_sensor_report_field report_field) = 0;
+
+            // Lets the reports of a sensor accumulate, up to max_reports or the reports of max_period_ms when not 0,
+            // before the capture wakes up for them. Applies from the next start, backends reading reports one by one ignore it
+            virtual void set_report_batching(uint32_t max_reports, uint32_t max_period_ms) {}
+
+            // Same as start_capture, with the reports read together delivered in a single call
+            virtual void start_batched_capture(hid_batch_callback callback)
+            {
+                start_capture([callback](const sensor_data& report) { callback(&report, 1); });
+            }
         };
 
         struct request_mapping;
@@ -372,6 +383,10 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            // Whether the frame buffers handed to the callback stay valid, and out of the capture queue, until the
+            // continuation is called, so that the frames may be delivered in them rather than in a copy
+            virtual bool retains_frame_buffers() const { return false; }
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -497,6 +512,11 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            bool retains_frame_buffers() const override
+            {
+                return _dev->retains_frame_buffers();
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -761,6 +781,14 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            bool retains_frame_buffers() const override
+            {
+                for (auto&& dev : _dev)
+                    if (!dev->retains_frame_buffers())
+                        return false;
+                return true;
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
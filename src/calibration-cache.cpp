@@ -0,0 +1,162 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "calibration-cache.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <thread>
+
+#ifdef WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace librealsense
+{
+    static const char* calibration_cache_var_name = "LRS_CALIBRATION_CACHE_DIR";
+
+#pragma pack(push, 1)
+    struct calibration_cache_header
+    {
+        uint32_t magic;
+        uint32_t size;
+        uint32_t crc32;
+    };
+#pragma pack(pop)
+
+    static const uint32_t calibration_cache_magic = 0x31435352; // "RSC1"
+
+    static int process_id()
+    {
+#ifdef WIN32
+        return _getpid();
+#else
+        return getpid();
+#endif
+    }
+
+    // File names made of the characters safe on every file system
+    static std::string file_name_part(std::string s)
+    {
+        std::replace_if(s.begin(), s.end(), [](char c) { return !isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-'; }, '_');
+        return s;
+    }
+
+    calibration_cache::calibration_cache(const std::string& dir, const std::string& serial, const std::string& fw_version)
+    {
+        if (dir.empty() || serial.empty() || fw_version.empty())
+            return;
+
+        _prefix = dir;
+        if (_prefix.back() != '/' && _prefix.back() != '\\')
+            _prefix += '/';
+        _prefix += file_name_part(serial) + "_" + file_name_part(fw_version) + "_";
+    }
+
+    calibration_cache calibration_cache::open(const std::string& serial, const std::string& fw_version)
+    {
+        auto dir = getenv(calibration_cache_var_name);
+        return calibration_cache(dir ? dir : "", serial, fw_version);
+    }
+
+    std::string calibration_cache::path(const std::string& name) const
+    {
+        return _prefix + file_name_part(name) + ".bin";
+    }
+
+    std::vector<uint8_t> calibration_cache::get(const std::string& name, std::function<std::vector<uint8_t>()> read) const
+    {
+        if (!is_enabled())
+            return read();
+
+        auto file = path(name);
+        std::vector<uint8_t> table;
+        if (load(file, table))
+            return table;
+
+        table = read();
+        if (!table.empty())
+            store(file, table);
+        return table;
+    }
+
+    bool calibration_cache::load(const std::string& file, std::vector<uint8_t>& table) const
+    {
+        std::ifstream in(file, std::ios::binary | std::ios::ate);
+        if (!in)
+            return false;
+        auto file_size = static_cast<uint64_t>(in.tellg());
+        in.seekg(0);
+
+        // The size is checked against the file before anything is allocated for the table
+        calibration_cache_header header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != calibration_cache_magic ||
+            file_size != sizeof(header) + static_cast<uint64_t>(header.size))
+        {
+            LOG_WARNING("Ignoring invalid calibration cache file " << file);
+            return false;
+        }
+
+        try
+        {
+            table.resize(header.size);
+        }
+        catch (const std::bad_alloc&)
+        {
+            LOG_WARNING("Ignoring calibration cache file " << file << " of " << header.size << " bytes");
+            table.clear();
+            return false;
+        }
+
+        if (!in.read(reinterpret_cast<char*>(table.data()), table.size()) || in.peek() != EOF ||
+            calc_crc32(table.data(), table.size()) != header.crc32)
+        {
+            LOG_WARNING("Ignoring corrupted calibration cache file " << file);
+            table.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void calibration_cache::store(const std::string& file, const std::vector<uint8_t>& table) const
+    {
+        calibration_cache_header header = { calibration_cache_magic, static_cast<uint32_t>(table.size()),
+            calc_crc32(table.data(), table.size()) };
+
+        // Written aside and moved in place, so that another process reads either no file or a whole one. Thread ids
+        // repeat across processes, the name takes the process id as well
+        std::string tmp = to_string() << file << "." << process_id() << "." << std::this_thread::get_id() << ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(table.data()), table.size());
+            if (!out)
+            {
+                LOG_WARNING("Failed to write calibration cache file " << tmp);
+                out.close();
+                std::remove(tmp.c_str());
+                return;
+            }
+        }
+
+        std::remove(file.c_str());
+        if (std::rename(tmp.c_str(), file.c_str()) != 0)
+        {
+            LOG_WARNING("Failed to write calibration cache file " << file);
+            std::remove(tmp.c_str());
+        }
+    }
+
+    void calibration_cache::erase(const std::string& name) const
+    {
+        if (is_enabled())
+            std::remove(path(name).c_str());
+    }
+}
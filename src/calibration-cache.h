@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    // On-disk cache of the tables a device reads from its flash on every construction, such as the calibration tables.
+    // It is enabled by pointing the LRS_CALIBRATION_CACHE_DIR environment variable to an existing directory.
+    // The tables are stored per device serial number and firmware version, each file carrying the checksum of its table,
+    // a missing, truncated or corrupted file is read from the device again.
+    // Tables written to the device outside of librealsense are not noticed, the directory has to be cleared then
+    class calibration_cache
+    {
+    public:
+        // A disabled cache, reading every table from the device
+        calibration_cache() {}
+
+        // The cache of the device of the given serial number and firmware version in dir, disabled when dir is empty
+        calibration_cache(const std::string& dir, const std::string& serial, const std::string& fw_version);
+
+        // The cache of the device in the directory of LRS_CALIBRATION_CACHE_DIR
+        static calibration_cache open(const std::string& serial, const std::string& fw_version);
+
+        bool is_enabled() const { return !_prefix.empty(); }
+
+        // The cached table of the given name, read from the device and stored when not cached.
+        // Empty tables are not stored
+        std::vector<uint8_t> get(const std::string& name, std::function<std::vector<uint8_t>()> read) const;
+
+        // Drops the cached table of the given name, once it was written to the device
+        void erase(const std::string& name) const;
+
+    private:
+        std::string path(const std::string& name) const;
+        bool load(const std::string& file, std::vector<uint8_t>& table) const;
+        void store(const std::string& file, const std::vector<uint8_t>& table) const;
+
+        std::string _prefix;    // Directory and device part of the file names, empty when disabled
+    };
+}
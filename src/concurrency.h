@@ -8,6 +8,10 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <vector>
+#include <memory>
+#include <exception>
+#include <algorithm>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -443,4 +447,148 @@ private:
     bool _blocker = true;
     std::function<void()> _operation;
     std::shared_ptr<active_object<>> _watcher;
-};
\ No newline at end of file
+};
+// Fixed-size pool of worker threads used by the processing blocks to split
+// per-frame work (rows, tiles) across cores. The calling thread always takes
+// part in the work it submits, so nested or concurrent parallel_for calls
+// cannot dead-lock even when all workers are busy.
+class thread_pool
+{
+public:
+    explicit thread_pool(unsigned int threads = std::thread::hardware_concurrency())
+        : _is_alive(true)
+    {
+        // The calling thread acts as one of the workers
+        auto workers = std::max(1u, threads) - 1;
+        for (unsigned int i = 0; i < workers; i++)
+        {
+            _threads.emplace_back([this]()
+            {
+                while (true)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _cv.wait(lock, [this]() { return !_tasks.empty() || !_is_alive; });
+                        if (!_is_alive && _tasks.empty())
+                            return;
+                        task = std::move(_tasks.front());
+                        _tasks.pop_front();
+                    }
+                    try
+                    {
+                        task();
+                    }
+                    catch (...) {}
+                }
+            });
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _is_alive = false;
+        }
+        _cv.notify_all();
+        for (auto&& t : _threads)
+            t.join();
+    }
+
+    // Number of threads taking part in a parallel_for, including the caller
+    size_t size() const { return _threads.size() + 1; }
+
+    // Queue a task for asynchronous execution on one of the workers.
+    // When the pool has no workers the task is executed immediately
+    void submit(std::function<void()> task)
+    {
+        if (_threads.empty())
+        {
+            task();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.push_back(std::move(task));
+        }
+        _cv.notify_one();
+    }
+
+    // Split [begin, end) into contiguous ranges of at least min_range elements and
+    // invoke func(from, to) on each range concurrently. Returns once all ranges were
+    // processed; the first exception thrown by func is re-thrown to the caller
+    template<class F>
+    void parallel_for(int begin, int end, F func, int min_range = 1)
+    {
+        if (end <= begin) return;
+
+        auto count = end - begin;
+        auto ranges = std::min<int>(static_cast<int>(size()) * 4, std::max(1, count / std::max(1, min_range)));
+        if (ranges <= 1 || _threads.empty())
+        {
+            func(begin, end);
+            return;
+        }
+
+        struct job
+        {
+            std::atomic<int> next{ 0 };
+            std::atomic<int> done{ 0 };
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::exception_ptr error;
+        };
+        auto state = std::make_shared<job>();
+
+        auto run = [state, begin, count, ranges, &func]()
+        {
+            int r;
+            while ((r = state->next.fetch_add(1)) < ranges)
+            {
+                auto from = begin + static_cast<int>(static_cast<int64_t>(count) * r / ranges);
+                auto to = begin + static_cast<int>(static_cast<int64_t>(count) * (r + 1) / ranges);
+                try
+                {
+                    func(from, to);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (!state->error) state->error = std::current_exception();
+                }
+                if (state->done.fetch_add(1) + 1 == ranges)
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->cv.notify_all();
+                }
+            }
+        };
+
+        // Helpers that start after all ranges were claimed return immediately,
+        // so func is never touched after the caller returns
+        auto helpers = std::min<int>(static_cast<int>(_threads.size()), ranges - 1);
+        for (int i = 0; i < helpers; i++)
+            submit(run);
+        run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&]() { return state->done.load() == ranges; });
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+    // Process-wide pool shared by all processing blocks
+    static thread_pool& get_default()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+private:
+    std::vector<std::thread> _threads;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _is_alive;
+};
@@ -8,6 +8,8 @@
 
 #include <array>
 #include <chrono>
+#include <exception>
+#include <thread>
 #include "l500/l500-depth.h"
 #include "ivcam/sr300.h"
 #include "ds5/ds5-factory.h"
@@ -107,7 +109,8 @@ namespace librealsense
                      const char* section,
                      rs2_recording_mode mode,
                      std::string min_api_version)
-        : _devices_changed_callback(nullptr, [](rs2_devices_changed_callback*){})
+        : _devices_changed_callback(nullptr, [](rs2_devices_changed_callback*){}),
+          _live_backend(false), _device_group_generation(0), _watching_devices(false)
     {
         LOG_DEBUG("Librealsense " << std::string(std::begin(rs2_api_version),std::end(rs2_api_version)));
 
@@ -115,6 +118,7 @@ namespace librealsense
         {
         case backend_type::standard:
             _backend = platform::create_backend();
+            _live_backend = true;
 #if WITH_TRACKING
             _tm2_context = std::make_shared<tm2_context>(this);
             _tm2_context->on_device_changed += [this](std::shared_ptr<tm2_info> removed, std::shared_ptr<tm2_info> added)-> void
@@ -314,13 +318,41 @@ namespace librealsense
 
     context::~context()
     {
-        _device_watcher->stop(); //ensure that the device watcher will stop before the _devices_changed_callback will be deleted
+        stop_device_watcher(); //ensure that the device watcher will stop before the _devices_changed_callback will be deleted
     }
 
-    std::vector<std::shared_ptr<device_info>> context::query_devices(int mask) const
+    void context::stop_device_watcher()
     {
+        _device_watcher->stop();
+
+        // Without the watcher the devices may change unnoticed
+        std::lock_guard<std::mutex> lock(_device_group_mutex);
+        _watching_devices = false;
+        _device_group.reset();
+        ++_device_group_generation;
+    }
+
+    platform::backend_device_group context::query_device_group() const
+    {
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(_device_group_mutex);
+            if (_device_group)
+                return *_device_group;
+            generation = _device_group_generation;
+        }
 
         platform::backend_device_group devices(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
+
+        std::lock_guard<std::mutex> lock(_device_group_mutex);
+        if (_live_backend && _watching_devices && generation == _device_group_generation)
+            _device_group = std::make_shared<platform::backend_device_group>(devices);
+        return devices;
+    }
+
+    std::vector<std::shared_ptr<device_info>> context::query_devices(int mask) const
+    {
+        auto devices = query_device_group();
 #ifdef WITH_TRACKING
         if (_tm2_context) _tm2_context->create_manager();
 #endif
@@ -382,6 +414,54 @@ namespace librealsense
     }
 
 
+    std::vector<std::shared_ptr<device_interface>> context::create_devices_concurrently(
+        const std::vector<std::shared_ptr<device_info>>& infos) const
+    {
+        std::vector<std::shared_ptr<device_interface>> devices(infos.size());
+        if (!_live_backend || infos.size() < 2)
+        {
+            for (size_t i = 0; i < infos.size(); ++i)
+                devices[i] = infos[i]->create_device();
+            return devices;
+        }
+
+        // Every device talks to its own hardware monitor and nodes, the shared state they register with is locked
+        std::vector<std::exception_ptr> errors(infos.size());
+        std::vector<std::thread> threads;
+        try
+        {
+            threads.reserve(infos.size());
+            for (size_t i = 0; i < infos.size(); ++i)
+            {
+                threads.emplace_back([&, i]()
+                {
+                    try
+                    {
+                        devices[i] = infos[i]->create_device();
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                });
+            }
+        }
+        catch (...)
+        {
+            // The threads started use the results of this call, they end before it fails
+            for (auto&& t : threads)
+                t.join();
+            throw;
+        }
+        for (auto&& t : threads)
+            t.join();
+
+        for (auto&& e : errors)
+            if (e)
+                std::rethrow_exception(e);
+        return devices;
+    }
+
     void context::on_device_changed(platform::backend_device_group old,
                                     platform::backend_device_group curr,
                                     const std::map<std::string, std::weak_ptr<device_info>>& old_playback_devices,
@@ -464,13 +544,21 @@ namespace librealsense
 
     void context::set_devices_changed_callback(devices_changed_callback_ptr callback)
     {
-        _device_watcher->stop();
+        stop_device_watcher();
 
         _devices_changed_callback = std::move(callback);
         _device_watcher->start([this](platform::backend_device_group old, platform::backend_device_group curr)
         {
+            {
+                std::lock_guard<std::mutex> lock(_device_group_mutex);
+                _device_group.reset();
+                ++_device_group_generation;
+            }
             on_device_changed(old, curr, _playback_devices, _playback_devices);
         });
+
+        std::lock_guard<std::mutex> lock(_device_group_mutex);
+        _watching_devices = true;
     }
 
     std::vector<platform::uvc_device_info> filter_by_product(const std::vector<platform::uvc_device_info>& devices, const std::set<uint16_t>& pid_list)
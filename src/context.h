@@ -115,10 +115,12 @@ namespace librealsense
             rs2_recording_mode mode = RS2_RECORDING_MODE_COUNT,
             std::string min_api_version = "0.0.0");
 
-        void stop(){ if (!_devices_changed_callbacks.size()) _device_watcher->stop();}
+        void stop(){ if (!_devices_changed_callbacks.size()) stop_device_watcher();}
         ~context();
         std::vector<std::shared_ptr<device_info>> query_devices(int mask) const;
         const platform::backend& get_backend() const { return *_backend; }
+        // Whether the backend talks to the devices, rather than recording or playing back the calls to them
+        bool has_live_backend() const { return _live_backend; }
 
         uint64_t register_internal_device_callback(devices_changed_callback_ptr callback);
         void unregister_internal_device_callback(uint64_t cb_id);
@@ -127,6 +129,11 @@ namespace librealsense
         std::vector<std::shared_ptr<device_info>> create_devices(platform::backend_device_group devices,
             const std::map<std::string, std::weak_ptr<device_info>>& playback_devices, int mask) const;
 
+        // Creates the devices of infos at once, on a thread each, and returns when all of them are ready.
+        // The first failure is thrown once every thread is done
+        std::vector<std::shared_ptr<device_interface>> create_devices_concurrently(
+            const std::vector<std::shared_ptr<device_info>>& infos) const;
+
         std::shared_ptr<playback_device_info> add_device(const std::string& file);
         void remove_device(const std::string& file);
 
@@ -141,6 +148,8 @@ namespace librealsense
                                platform::backend_device_group curr,
                                const std::map<std::string, std::weak_ptr<device_info>>& old_playback_devices,
                                const std::map<std::string, std::weak_ptr<device_info>>& new_playback_devices);
+        void stop_device_watcher();
+        platform::backend_device_group query_device_group() const;
         void raise_devices_changed(const std::vector<rs2_device_info>& removed, const std::vector<rs2_device_info>& added);
         int find_stream_profile(const stream_interface& p);
         std::shared_ptr<lazy<rs2_extrinsics>> fetch_edge(int from, int to);
@@ -150,6 +159,17 @@ namespace librealsense
         std::shared_ptr<tm2_context> _tm2_context;
 #endif
         std::shared_ptr<platform::device_watcher> _device_watcher;
+
+        // Recording and playback replay the calls to the backend in order, only the live backend is cached
+        // and called from several threads at once
+        bool _live_backend;
+
+        // Devices of the last enumeration, reused while the device watcher reports the changes to them.
+        // The generation moves on with every change, so that an enumeration racing a change is not kept
+        mutable std::mutex _device_group_mutex;
+        mutable std::shared_ptr<platform::backend_device_group> _device_group;
+        mutable uint64_t _device_group_generation;
+        bool _watching_devices;
         std::map<std::string, std::weak_ptr<device_info>> _playback_devices;
         std::map<uint64_t, devices_changed_callback_ptr> _devices_changed_callbacks;
 
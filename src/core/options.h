@@ -41,6 +41,16 @@ namespace librealsense
         virtual bool supports_option(rs2_option id) const = 0;
         virtual std::vector<rs2_option> get_supported_options() const = 0;
         virtual const char* get_option_name(rs2_option) const = 0;
+
+        // Values of several options at once, in the order of ids
+        virtual std::vector<float> query_options(const std::vector<rs2_option>& ids) const
+        {
+            std::vector<float> values;
+            for (auto id : ids)
+                values.push_back(get_option(id).query());
+            return values;
+        }
+
         virtual ~options_interface() = default;
     };
 
@@ -37,7 +37,7 @@ namespace librealsense
             auto laser_power = std::make_shared<uvc_xu_option<uint16_t>>(raw_depth_ep,
                                                                          depth_xu,
                                                                          DS5_LASER_POWER,
-                                                                         "Manual laser power in mw. applicable only when laser power mode is set to Manual");
+                                                                         "Manual laser power in mw. applicable only when laser power mode is set to Manual", true);
             depth_ep.register_option(RS2_OPTION_LASER_POWER,
                                      std::make_shared<auto_disabling_control>(
                                      laser_power,
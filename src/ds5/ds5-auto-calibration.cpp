@@ -439,6 +439,7 @@ namespace librealsense
         command write_calib( ds::SETINTCAL, set_coefficients );
         write_calib.data = _curr_calibration;
         _hw_monitor->send(write_calib);
+        calibration_written();
     }
 
     void auto_calibrated::set_calibration_table(const std::vector<uint8_t>& calibration)
@@ -458,5 +459,6 @@ namespace librealsense
     {
         command cmd(ds::fw_cmd::CAL_RESTORE_DFLT);
         _hw_monitor->send(cmd);
+        calibration_written();
     }
 }
@@ -62,6 +62,10 @@ namespace librealsense
         void set_calibration_table(const std::vector<uint8_t>& calibration) override;
         void reset_to_factory_calibration() const override;
 
+    protected:
+        // Called once the calibration of the device was written
+        virtual void calibration_written() const {}
+
     private:
         std::vector<uint8_t> get_calibration_results(float* health = nullptr) const;
         void handle_calibration_error(rs2_dsc_status status) const;
@@ -480,22 +480,42 @@ namespace librealsense
         return fabs(table->baseline);
     }
 
+    static std::string calibration_table_name(ds::calibration_table_id table_id)
+    {
+        return to_string() << "calibration-" << int(table_id);
+    }
+
+    static const char* new_calibration_table_name = "calibration-new";
+
     std::vector<uint8_t> ds5_device::get_raw_calibration_table(ds::calibration_table_id table_id) const
     {
-        command cmd(ds::GETINTCAL, table_id);
-        return _hw_monitor->send(cmd);
+        return _calibration_cache.get(calibration_table_name(table_id), [&]()
+        {
+            command cmd(ds::GETINTCAL, table_id);
+            return _hw_monitor->send(cmd);
+        });
     }
 
     std::vector<uint8_t> ds5_device::get_new_calibration_table() const
     {
         if (_fw_version >= firmware_version("5.11.9.5"))
         {
-            command cmd(ds::RECPARAMSGET);
-            return _hw_monitor->send(cmd);
+            return _calibration_cache.get(new_calibration_table_name, [&]()
+            {
+                command cmd(ds::RECPARAMSGET);
+                return _hw_monitor->send(cmd);
+            });
         }
         return {};
     }
 
+    void ds5_device::calibration_written() const
+    {
+        _calibration_cache.erase(calibration_table_name(ds::coefficients_table_id));
+        _calibration_cache.erase(calibration_table_name(ds::rgb_calibration_id));
+        _calibration_cache.erase(new_calibration_table_name);
+    }
+
     ds::d400_caps ds5_device::parse_device_capabilities(const uint16_t pid) const
     {
         using namespace ds;
@@ -631,6 +651,10 @@ namespace librealsense
         auto fwv = _hw_monitor->get_firmware_version_string(gvd_buff, camera_fw_version_offset);
         _fw_version = firmware_version(fwv);
 
+        // Recordings hold the table reads, they are not cached while recording or playing back
+        if (ctx->has_live_backend())
+            _calibration_cache = calibration_cache::open(optic_serial, fwv);
+
         _recommended_fw_version = firmware_version(D4XX_RECOMMENDED_FIRMWARE_VERSION);
         if (_fw_version >= firmware_version("5.10.4.0"))
             _device_capabilities = parse_device_capabilities(pid);
@@ -674,10 +698,10 @@ namespace librealsense
         {
             depth_sensor.register_option(RS2_OPTION_HARDWARE_PRESET,
                 std::make_shared<uvc_xu_option<uint8_t>>(raw_depth_sensor, depth_xu, DS5_HARDWARE_PRESET,
-                    "Hardware pipe configuration"));
+                    "Hardware pipe configuration", true));
             depth_sensor.register_option(RS2_OPTION_LED_POWER,
                 std::make_shared<uvc_xu_option<uint16_t>>(raw_depth_sensor, depth_xu, DS5_LED_PWR,
-                    "Set the power level of the LED, with 0 meaning LED off"));
+                    "Set the power level of the LED, with 0 meaning LED off", true));
         }
 
         if (_fw_version >= firmware_version("5.6.3.0"))
@@ -707,7 +731,7 @@ namespace librealsense
             auto enable_auto_exposure = std::make_shared<uvc_xu_option<uint8_t>>(raw_depth_sensor,
                 depth_xu,
                 DS5_ENABLE_AUTO_EXPOSURE,
-                "Enable Auto Exposure");
+                "Enable Auto Exposure", true);
             depth_sensor.register_option(RS2_OPTION_ENABLE_AUTO_EXPOSURE, enable_auto_exposure);
 
             depth_sensor.register_option(RS2_OPTION_EXPOSURE,
@@ -720,7 +744,7 @@ namespace librealsense
         {
             depth_sensor.register_option(RS2_OPTION_OUTPUT_TRIGGER_ENABLED,
                 std::make_shared<uvc_xu_option<uint8_t>>(raw_depth_sensor, depth_xu, DS5_EXT_TRIGGER,
-                    "Generate trigger from the camera to external device once per frame"));
+                    "Generate trigger from the camera to external device once per frame", true));
 
             auto error_control = std::unique_ptr<uvc_xu_option<uint8_t>>(new uvc_xu_option<uint8_t>(raw_depth_sensor, depth_xu, DS5_ERROR_REPORTING, "Error reporting"));
 
@@ -964,7 +988,7 @@ namespace librealsense
             auto laser_power = std::make_shared<uvc_xu_option<uint16_t>>(depth_ep,
                 depth_xu,
                 DS5_LASER_POWER,
-                "Manual laser power in mw. applicable only when laser power mode is set to Manual");
+                "Manual laser power in mw. applicable only when laser power mode is set to Manual", true);
             depth_ep.register_option(RS2_OPTION_LASER_POWER,
                 std::make_shared<auto_disabling_control>(
                     laser_power,
@@ -13,6 +13,7 @@
 #include "global_timestamp_reader.h"
 #include "fw-update/fw-update-device-interface.h"
 #include "ds5-auto-calibration.h"
+#include "calibration-cache.h"
 
 namespace librealsense
 {
@@ -69,6 +70,9 @@ namespace librealsense
         std::vector<uint8_t> get_raw_calibration_table(ds::calibration_table_id table_id) const;
         std::vector<uint8_t> get_new_calibration_table() const;
 
+        // Drops the calibration tables cached on disk, the device calibration changed
+        void calibration_written() const override;
+
         bool is_camera_in_advanced_mode() const;
 
         float get_stereo_baseline_mm() const;
@@ -83,6 +87,7 @@ namespace librealsense
         std::shared_ptr<hw_monitor> _hw_monitor;
         firmware_version            _fw_version;
         firmware_version            _recommended_fw_version;
+        calibration_cache           _calibration_cache;
         ds::d400_caps               _device_capabilities;
 
         std::shared_ptr<stream_interface> _depth_stream;
@@ -212,6 +212,8 @@ namespace librealsense
         auto hid_ep = std::make_shared<ds5_hid_sensor>("Motion Module", raw_hid_ep, this, this);
 
         hid_ep->register_option(RS2_OPTION_GLOBAL_TIME_ENABLED, enable_global_time_option);
+        hid_ep->register_option(RS2_OPTION_MOTION_BATCH_SIZE, raw_hid_ep->get_batch_size_option());
+        hid_ep->register_option(RS2_OPTION_MOTION_BATCH_PERIOD, raw_hid_ep->get_batch_period_option());
 
         // register pre-processing
         bool enable_motion_correction = false;
@@ -35,7 +35,7 @@ namespace librealsense
                 std::make_shared<uvc_xu_option<uint8_t>>(get_raw_depth_sensor(),
                                                          depth_xu,
                                                          DS5_ENABLE_AUTO_WHITE_BALANCE,
-                                                         "Enable Auto White Balance"));
+                                                         "Enable Auto White Balance", true));
 
             // RS400 rolling-shutter Skus allow to get low-quality color image from the same viewport as the depth
             depth_ep.register_processing_block({ {RS2_FORMAT_BGR8} }, { {RS2_FORMAT_RGB8, RS2_STREAM_INFRARED} }, []() { return std::make_shared<bgr_to_rgb>(); });
@@ -5,6 +5,8 @@
 
 namespace librealsense
 {
+    static const size_t max_cached_paths = 1024;
+
     extrinsics_graph::extrinsics_graph()
         : _locks_count(0)
     {
@@ -43,6 +45,7 @@ namespace librealsense
 
         _extrinsics[from_idx][to_idx] = extr;
         _extrinsics[to_idx][from_idx] = std::shared_ptr<lazy<rs2_extrinsics>>(nullptr);
+        invalidate_paths();
     }
 
     void extrinsics_graph::register_extrinsics(const stream_interface & from, const stream_interface & to, rs2_extrinsics extr)
@@ -82,7 +85,10 @@ namespace librealsense
         }
 
         if (!invalid_ids.empty())
+        {
+            invalidate_paths();
             LOG_INFO("Found " << invalid_ids.size() << " unreachable streams, " << counter << " extrinsics deleted");
+        }
     }
 
     int extrinsics_graph::find_stream_profile(const stream_interface& p)
@@ -102,6 +108,17 @@ namespace librealsense
 
     bool extrinsics_graph::try_fetch_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr)
     {
+        if (&from == &to)
+        {
+            *extr = identity_matrix();
+            return true;
+        }
+
+        // The streams query their extrinsics on every change of profiles, and sometimes on every frame
+        bool found;
+        if (try_fetch_cached_extrinsics(from, to, extr, found))
+            return found;
+
         std::lock_guard<std::mutex> lock(_mutex);
         cleanup_extrinsics();
         auto from_idx = find_stream_profile(from);
@@ -114,10 +131,73 @@ namespace librealsense
         }
 
         std::set<int> visited;
-        return try_fetch_extrinsics(from_idx, to_idx, visited, extr);
+        // Holds the edges of the path until the extrinsics are evaluated
+        std::vector<std::shared_ptr<lazy<rs2_extrinsics>>> held;
+        extrinsics_path path{ from.shared_from_this(), to.shared_from_this(), {} };
+        found = try_find_path(from_idx, to_idx, visited, held, path.edges);
+
+        auto paths = std::make_shared<extrinsics_paths>();
+        // Bounded for the applications creating streams without end, the paths are found again as queried
+        if (_paths && _paths->size() < max_cached_paths)
+            *paths = *_paths;
+        (*paths)[std::make_pair(&from, &to)] = path;
+        std::atomic_store(&_paths, std::shared_ptr<const extrinsics_paths>(paths));
+
+        return found && try_compose_extrinsics(path.edges, extr);
     }
 
-    bool extrinsics_graph::try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr)
+    bool extrinsics_graph::try_fetch_cached_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr, bool& found)
+    {
+        auto paths = std::atomic_load(&_paths);
+        if (!paths)
+            return false;
+
+        auto it = paths->find(std::make_pair(&from, &to));
+        if (it == paths->end())
+            return false;
+
+        // The path of streams since destroyed, whose addresses were reused, is not theirs
+        auto&& path = it->second;
+        if (path.from.lock().get() != &from || path.to.lock().get() != &to)
+            return false;
+
+        // The edges only go away without the graph changing, a stream that had no path still has none
+        found = !path.edges.empty();
+        if (!found)
+            return true;
+
+        // An edge of the path is gone, another path may remain
+        return try_compose_extrinsics(path.edges, extr);
+    }
+
+    bool extrinsics_graph::try_compose_extrinsics(const std::vector<extrinsics_edge>& edges, rs2_extrinsics* extr)
+    {
+        if (edges.empty())
+            return false;
+
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            auto edge = edges[i].extr.lock();
+            if (!edge)
+                return false;
+
+            // Evaluate the expression
+            auto local = edges[i].inverse ? inverse(edge->operator*()) : edge->operator*();
+            if (i == 0)
+                *extr = local;
+            else
+                *extr = from_pose(to_pose(*extr) * to_pose(local));
+        }
+        return true;
+    }
+
+    void extrinsics_graph::invalidate_paths()
+    {
+        std::atomic_store(&_paths, std::shared_ptr<const extrinsics_paths>());
+    }
+
+    bool extrinsics_graph::try_find_path(int from, int to, std::set<int>& visited,
+        std::vector<std::shared_ptr<lazy<rs2_extrinsics>>>& held, std::vector<extrinsics_edge>& edges)
     {
         if (visited.count(from)) return false;
 
@@ -130,11 +210,8 @@ namespace librealsense
             // Make sure both parts of the edge are still available
             if (fwd_edge.get() || back_edge.get())
             {
-                if (fwd_edge.get())
-                    *extr = fwd_edge->operator*(); // Evaluate the expression
-                else
-                    *extr = inverse(back_edge->operator*());
-
+                held.push_back(fwd_edge.get() ? fwd_edge : back_edge);
+                edges.push_back({ held.back(), !fwd_edge.get() });
                 return true;
             }
             else
@@ -143,24 +220,17 @@ namespace librealsense
                 for (auto&& kvp : it->second)
                 {
                     auto new_from = kvp.first;
-                    auto way = kvp.second;
 
                     // Lock down the edge in both directions to ensure we can evaluate the extrinsics
                     back_edge = fetch_edge(new_from, from);
                     fwd_edge = fetch_edge(from, new_from);
 
+                    // The edges are gathered from the last one, the edge from from goes after those of the rest of the path
                     if ((back_edge.get() || fwd_edge.get()) &&
-                        try_fetch_extrinsics(new_from, to, visited, extr))
+                        try_find_path(new_from, to, visited, held, edges))
                     {
-                        const auto local = [&]() {
-                            if (fwd_edge.get())
-                                return fwd_edge->operator*(); // Evaluate the expression
-                            else
-                                return inverse(back_edge->operator*());
-                        }();
-
-                        auto pose = to_pose(*extr) * to_pose(local);
-                        *extr = from_pose(pose);
+                        held.push_back(fwd_edge.get() ? fwd_edge : back_edge);
+                        edges.push_back({ held.back(), !fwd_edge.get() });
                         return true;
                     }
                 }
@@ -44,14 +44,38 @@ namespace librealsense
         extrinsics_lock lock();
 
     private:
+        // An edge of a path, inverse when the extrinsics are registered in the other direction
+        struct extrinsics_edge
+        {
+            std::weak_ptr<lazy<rs2_extrinsics>> extr;
+            bool inverse;
+        };
+
+        // The edges found from one stream to another, from the last edge to the first, so that a repeated lookup
+        // only composes the extrinsics along them. A lookup that found no path has no edges
+        struct extrinsics_path
+        {
+            std::weak_ptr<const stream_interface> from;
+            std::weak_ptr<const stream_interface> to;
+            std::vector<extrinsics_edge> edges;
+        };
+        typedef std::map<std::pair<const stream_interface*, const stream_interface*>, extrinsics_path> extrinsics_paths;
+
+        // False when the lookup has to go through the graph, otherwise found tells whether extr was fetched
+        bool try_fetch_cached_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr, bool& found);
+        static bool try_compose_extrinsics(const std::vector<extrinsics_edge>& edges, rs2_extrinsics* extr);
+        void invalidate_paths();
+
         std::mutex _mutex;
+        // Replaced as a whole under the mutex and read without it, dropped whenever the graph changes
+        std::shared_ptr<const extrinsics_paths> _paths;
         std::shared_ptr<lazy<rs2_extrinsics>> _id;
         // Required by current implementation to hold the reference instead of the device for certain types. TODO
         std::vector<std::shared_ptr<lazy<rs2_extrinsics>>> _external_extrinsics;
 
     PRIVATE_TESTABLE:
         std::shared_ptr<lazy<rs2_extrinsics>> fetch_edge(int from, int to);
-        bool try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr);
+        bool try_find_path(int from, int to, std::set<int>& visited, std::vector<std::shared_ptr<lazy<rs2_extrinsics>>>& held, std::vector<extrinsics_edge>& edges);
         void cleanup_extrinsics();
         int find_stream_profile(const stream_interface& p);
 
@@ -35,10 +35,11 @@ namespace librealsense
 
                 if (requires_memory)
                 {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
+                    // Attempt to obtain a buffer of the appropriate size from the freelist.
+                    // Buffers shrunk after allocation (sparse point clouds) still hold their original capacity
                     for (auto it = begin(freelist); it != end(freelist); ++it)
                     {
-                        if (it->data.size() == size)
+                        if (it->data.size() == size || it->data.capacity() == size)
                         {
                             backbuffer = std::move(*it);
                             freelist.erase(it);
@@ -48,6 +48,8 @@ namespace librealsense
         case RS2_FORMAT_INZI: return 32;
         case RS2_FORMAT_INVI: return 16;
         case RS2_FORMAT_W10: return 32;
+        case RS2_FORMAT_XYZ16: return 6 * 8;
+        case RS2_FORMAT_XYZ16F: return 6 * 8;
         default: assert(false); return 0;
         }
     }
@@ -28,7 +28,7 @@ namespace librealsense
         static const char* fw_ver = "1.2.11.0";
 
         if(_fw_version >= firmware_version(fw_ver))
-            return _hw_monitor->send(command{ DPT_INTRINSICS_FULL_GET });
+            return _calibration_cache.get("depth-intrinsics", [&]() { return _hw_monitor->send(command{ DPT_INTRINSICS_FULL_GET }); });
         else
         {
             //WA untill fw will fix DPT_INTRINSICS_GET command
@@ -90,6 +90,10 @@ namespace librealsense
         auto fwv = _hw_monitor->get_firmware_version_string(gvd_buff, fw_version_offset);
         _fw_version = firmware_version(fwv);
 
+        // Recordings hold the table reads, they are not cached while recording or playing back
+        if (ctx->has_live_backend())
+            _calibration_cache = calibration_cache::open(optic_serial, fwv);
+
         _is_locked = _hw_monitor->get_gvd_field<bool>(gvd_buff, is_camera_locked_offset);
 
         // TODO: flash lock is not suuported yet.
@@ -16,6 +16,7 @@
 #include "error-handling.h"
 #include "global_timestamp_reader.h"
 #include "fw-update/fw-update-device-interface.h"
+#include "calibration-cache.h"
 
 namespace librealsense
 {
@@ -71,6 +72,7 @@ namespace librealsense
 
         lazy<std::vector<uint8_t>> _calib_table_raw;
         firmware_version _fw_version;
+        calibration_cache _calibration_cache;
 
         std::shared_ptr<stream_interface> _depth_stream;
         std::shared_ptr<stream_interface> _ir_stream;
@@ -120,6 +120,8 @@ namespace librealsense
         hid_ep->register_option(RS2_OPTION_GLOBAL_TIME_ENABLED, enable_global_time_option);
         hid_ep->get_option(RS2_OPTION_GLOBAL_TIME_ENABLED).set(0);
         hid_ep->register_option(RS2_OPTION_GLOBAL_TIME_ENABLED, enable_global_time_option);
+        hid_ep->register_option(RS2_OPTION_MOTION_BATCH_SIZE, raw_hid_ep->get_batch_size_option());
+        hid_ep->register_option(RS2_OPTION_MOTION_BATCH_PERIOD, raw_hid_ep->get_batch_period_option());
 
         hid_ep->register_processing_block(
             { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_ACCEL} },
@@ -428,6 +428,9 @@ namespace librealsense
         iio_hid_sensor::iio_hid_sensor(const std::string& device_path, uint32_t frequency)
             : _stop_pipe_fd{},
               _fd(0),
+              _frequency(frequency),
+              _watermark(1),
+              _buffer_length(hid_buf_len),
               _iio_device_number(0),
               _iio_device_path(device_path),
               _sensor_name(""),
@@ -457,12 +460,52 @@ namespace librealsense
             _inputs.clear();
         }
 
+        void iio_hid_sensor::set_batching(uint32_t max_reports, uint32_t max_period_ms)
+        {
+            // The period bounds the latency of the first report of a batch, whatever max_reports
+            uint32_t reports = std::max(max_reports, 1u);
+            if (max_period_ms > 0)
+                reports = std::min(reports, static_cast<uint32_t>(uint64_t(_frequency) * max_period_ms / 1000));
+
+            _watermark = std::max(reports, 1u);
+            // Leaves the kernel room for the reports arriving while a batch is delivered
+            _buffer_length = std::max(hid_buf_len, 2 * _watermark);
+        }
+
+        // The buffer geometry can be changed while the buffer is disabled only, so it goes through the power management queue
+        void iio_hid_sensor::configure_buffer()
+        {
+            auto path = _iio_device_path + "/buffer";
+            auto length = _buffer_length;
+            auto watermark = _watermark;
+
+            _pm_dispatcher.invoke([path, length, watermark](dispatcher::cancellable_timer /*t*/)
+            {
+                if (!write_fs_attribute(path + "/length", length))
+                    LOG_WARNING("HID buffer length " << length << " failed for " << path);
+
+                // Kernels predating the IIO watermark wake the reader on every report
+                if (!write_fs_attribute(path + "/watermark", watermark) && watermark > 1)
+                    LOG_WARNING("HID buffer watermark " << watermark << " failed for " << path);
+            }, true);
+        }
+
         // start capturing and polling.
         void iio_hid_sensor::start_capture(hid_callback sensor_callback)
+        {
+            start_batched_capture([sensor_callback](const sensor_data* reports, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    sensor_callback(reports[i]);
+            });
+        }
+
+        void iio_hid_sensor::start_batched_capture(hid_batch_callback sensor_callback)
         {
             if (_is_capturing)
                 return;
 
+            configure_buffer();
             set_power(true);
             std::ostringstream iio_read_device_path;
             iio_read_device_path << "/dev/" << IIO_DEVICE_PREFIX << _iio_device_number;
@@ -509,11 +552,15 @@ namespace librealsense
             _is_capturing = true;
             _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
                 const uint32_t channel_size = get_channel_size();
-                size_t raw_data_size = channel_size*hid_buf_len;
+                size_t raw_data_size = channel_size*_buffer_length;
 
                 std::vector<uint8_t> raw_data(raw_data_size);
                 auto metadata = has_metadata();
 
+                // A single read returns all the reports buffered up to the watermark, they are handed over together
+                std::vector<sensor_data> reports;
+                std::vector<metadata_hid_raw> reports_metadata;
+
                 do {
                     fd_set fds;
                     FD_ZERO(&fds);
@@ -552,17 +599,23 @@ namespace librealsense
                             continue;
                         }
 
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < read_size / channel_size; ++i)
+                        auto count = read_size / channel_size;
+                        auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+                        auto hid_data_size = channel_size - HID_METADATA_SIZE;
+
+                        // Sized once per read, so that the metadata pointers stay valid
+                        reports.resize(count);
+                        reports_metadata.resize(count);
+                        for (auto i = 0; i < count; ++i)
                         {
-                            auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
                             auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
+                            sensor_data& sens_data = reports[i];
+                            sens_data = {};
                             sens_data.sensor = hid_sensor{get_sensor_name()};
 
-                            auto hid_data_size = channel_size - HID_METADATA_SIZE;
                             // Populate HID IMU data - Header
-                            metadata_hid_raw meta_data{};
+                            metadata_hid_raw& meta_data = reports_metadata[i];
+                            meta_data = {};
                             meta_data.header.report_type = md_hid_report_type::hid_report_imu;
                             meta_data.header.length = hid_header_size + metadata_imu_report_size;
                             meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
@@ -581,17 +634,12 @@ namespace librealsense
                             //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
                             if (metadata)
                             {
-                                //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
-                                //*ts_nsec /=1000;
                                 meta_data.header.timestamp /=1000;
                             }
-
-//                            for (auto i=0ul; i<channel_size; i++)
-//                                std::cout << std::hex << int(p_raw_data[i]) << " ";
-//                            std::cout << std::dec << std::endl;
-
-                            this->_callback(sens_data);
                         }
+
+                        if (count > 0)
+                            this->_callback(reports.data(), reports.size());
                     }
                     else
                     {
@@ -783,7 +831,7 @@ namespace librealsense
                 input->enable(true);
 
             set_frequency(frequency);
-            write_fs_attribute(_iio_device_path + "/buffer/length", hid_buf_len);
+            write_fs_attribute(_iio_device_path + "/buffer/length", _buffer_length);
         }
 
         // calculate the storage size of a scan
@@ -1002,7 +1050,30 @@ namespace librealsense
             return iio_sensors;
         }
 
+        void v4l_hid_device::set_report_batching(uint32_t max_reports, uint32_t max_period_ms)
+        {
+            _batch_reports = max_reports;
+            _batch_period_ms = max_period_ms;
+        }
+
         void v4l_hid_device::start_capture(hid_callback callback)
+        {
+            start(
+                [callback](const sensor_data* reports, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        callback(reports[i]);
+                },
+                callback);
+        }
+
+        void v4l_hid_device::start_batched_capture(hid_batch_callback callback)
+        {
+            // The custom sensors read one report at a time
+            start(callback, [callback](const sensor_data& report) { callback(&report, 1); });
+        }
+
+        void v4l_hid_device::start(hid_batch_callback iio_callback, hid_callback custom_callback)
         {
             for (auto& profile : _hid_profiles)
             {
@@ -1032,7 +1103,8 @@ namespace librealsense
                 try{
                 for (auto& elem : _streaming_iio_sensors)
                 {
-                    elem->start_capture(callback);
+                    elem->set_batching(_batch_reports, _batch_period_ms);
+                    elem->start_batched_capture(iio_callback);
                     captured_sensors.push_back(elem);
                 }
                 }
@@ -1052,7 +1124,7 @@ namespace librealsense
                 try{
                 for (auto& elem : _streaming_custom_sensors)
                 {
-                    elem->start_capture(callback);
+                    elem->start_capture(custom_callback);
                     captured_sensors.push_back(elem);
                 }
                 }
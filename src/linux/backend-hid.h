@@ -139,12 +139,19 @@ namespace librealsense
             // start capturing and polling.
             void start_capture(hid_callback sensor_callback);
 
+            // start capturing, delivering the reports of every read in a single call
+            void start_batched_capture(hid_batch_callback sensor_callback);
+
             void stop_capture();
 
+            // Sets the IIO buffer watermark, the number of reports the capture waits for, from the next start
+            void set_batching(uint32_t max_reports, uint32_t max_period_ms);
+
             const std::string& get_sensor_name() const { return _sensor_name; }
 
         private:
             void clear_buffer();
+            void configure_buffer();
 
             void set_frequency(uint32_t frequency);
             void set_power(bool on);
@@ -173,13 +180,16 @@ namespace librealsense
 
             int _stop_pipe_fd[2]; // write to _stop_pipe_fd[1] and read from _stop_pipe_fd[0]
             int _fd;
+            uint32_t _frequency;
+            uint32_t _watermark;        // Reports the kernel buffers before the capture is woken up
+            uint32_t _buffer_length;    // Reports the kernel buffers at most, and the capture reads at once
             int _iio_device_number;
             std::string _iio_device_path;
             std::string _sensor_name;
             std::string _sampling_frequency_name;
             std::list<hid_input*> _inputs;
             std::list<hid_input*> _channels;
-            hid_callback _callback;
+            hid_batch_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
             std::unique_ptr<std::thread> _pm_thread;    // Delayed initialization due to power-up sequence
@@ -203,8 +213,12 @@ namespace librealsense
 
             void start_capture(hid_callback callback);
 
+            void start_batched_capture(hid_batch_callback callback);
+
             void stop_capture();
 
+            void set_report_batching(uint32_t max_reports, uint32_t max_period_ms) override;
+
             std::vector<uint8_t> get_custom_report_data(const std::string& custom_sensor_name,
                                                         const std::string& report_name,
                                                         custom_sensor_report_field report_field);
@@ -214,12 +228,16 @@ namespace librealsense
         private:
             static bool get_hid_device_info(const char* dev_path, hid_device_info& device_info);
 
+            void start(hid_batch_callback iio_callback, hid_callback custom_callback);
+
             std::vector<hid_profile> _hid_profiles;
             std::vector<hid_device_info> _hid_device_infos;
             std::vector<std::unique_ptr<iio_hid_sensor>> _iio_hid_sensors;
             std::vector<std::unique_ptr<hid_custom_sensor>> _hid_custom_sensors;
             std::vector<iio_hid_sensor*> _streaming_iio_sensors;
             std::vector<hid_custom_sensor*> _streaming_custom_sensors;
+            uint32_t _batch_reports = 1;
+            uint32_t _batch_period_ms = 0;
             static constexpr const char* custom_id{"custom"};
         };
     }
@@ -43,6 +43,11 @@
 #include <list>
 
 #include <sys/signalfd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <signal.h>
 #pragma GCC diagnostic ignored "-Woverflow"
 
@@ -580,6 +585,200 @@ namespace librealsense
             }
         }
 
+#ifndef V4L2_CAPTURE_REACTOR_THREADS
+#define V4L2_CAPTURE_REACTOR_THREADS 1
+#endif
+
+        std::shared_ptr<v4l_capture_reactor> v4l_capture_reactor::get_instance()
+        {
+            // Alive while a device uses it
+            static std::mutex instance_mutex;
+            static std::weak_ptr<v4l_capture_reactor> instance;
+
+            std::lock_guard<std::mutex> lock(instance_mutex);
+            auto reactor = instance.lock();
+            if (!reactor)
+            {
+                reactor = std::make_shared<v4l_capture_reactor>(V4L2_CAPTURE_REACTOR_THREADS);
+                instance = reactor;
+            }
+            return reactor;
+        }
+
+        v4l_capture_reactor::v4l_capture_reactor(int threads)
+            : _epoll_fd(-1), _wake_fd(-1), _is_running(true)
+        {
+            _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (_epoll_fd < 0)
+                throw linux_backend_exception("v4l_capture_reactor: epoll_create1 failed");
+
+            _wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (_wake_fd < 0)
+            {
+                ::close(_epoll_fd);
+                throw linux_backend_exception("v4l_capture_reactor: eventfd failed");
+            }
+
+            // Level-triggered, so that a single write wakes every thread up
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.fd = _wake_fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wake_fd, &ev) < 0)
+            {
+                ::close(_wake_fd);
+                ::close(_epoll_fd);
+                throw linux_backend_exception("v4l_capture_reactor: epoll_ctl failed for the wake up event");
+            }
+
+            for (int i = 0; i < std::max(threads, 1); ++i)
+                _threads.emplace_back([this]() { run(); });
+        }
+
+        v4l_capture_reactor::~v4l_capture_reactor()
+        {
+            _is_running = false;
+            uint64_t one = 1;
+            if (write(_wake_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("v4l_capture_reactor: could not wake the capture threads up");
+
+            for (auto&& t : _threads)
+                if (t.joinable()) t.join();
+
+            ::close(_wake_fd);
+            ::close(_epoll_fd);
+        }
+
+        void v4l_capture_reactor::add(int fd, std::function<void()> on_ready, std::function<void()> on_timeout)
+        {
+            auto w = std::make_shared<watch>();
+            w->fd = fd;
+            w->on_ready = on_ready;
+            w->on_timeout = on_timeout;
+            w->deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_watches.count(fd))
+                throw linux_backend_exception(to_string() << "v4l_capture_reactor: fd " << fd << " is already watched");
+
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLET | EPOLLONESHOT;
+            ev.data.fd = fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+                throw linux_backend_exception(to_string() << "v4l_capture_reactor: epoll_ctl failed for fd " << fd);
+
+            _watches[fd] = w;
+        }
+
+        void v4l_capture_reactor::remove(int fd)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            auto it = _watches.find(fd);
+            if (it == _watches.end())
+                return;
+
+            auto w = it->second;
+            _watches.erase(it);
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+                LOG_WARNING("v4l_capture_reactor: epoll_ctl failed to remove fd " << fd);
+
+            if (w->runner != std::this_thread::get_id())
+                _handler_done.wait(lock, [&]() { return !w->running; });
+        }
+
+        void v4l_capture_reactor::rearm(const watch& w)
+        {
+            // Reports the node again if it became readable while its handler ran
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLET | EPOLLONESHOT;
+            ev.data.fd = w.fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, w.fd, &ev) < 0)
+                LOG_ERROR("v4l_capture_reactor: epoll_ctl failed to rearm fd " << w.fd);
+        }
+
+        void v4l_capture_reactor::dispatch(std::shared_ptr<watch> w, bool timed_out)
+        {
+            try
+            {
+                if (timed_out)
+                    w->on_timeout();
+                else
+                    w->on_ready();
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR("v4l_capture_reactor: " << ex.what());
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                w->running = false;
+                w->runner = std::thread::id();
+                w->deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+                auto it = _watches.find(w->fd);
+                if (it != _watches.end() && it->second == w && (!timed_out || w->pending))
+                    rearm(*w);
+                w->pending = false;
+            }
+            _handler_done.notify_all();
+        }
+
+        void v4l_capture_reactor::run()
+        {
+            // Up to 64 nodes are serviced per wake up
+            epoll_event events[64];
+            while (_is_running)
+            {
+                int count = epoll_wait(_epoll_fd, events, 64, 1000);
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+
+                    LOG_ERROR("v4l_capture_reactor: epoll_wait failed, errno " << errno);
+                    return;
+                }
+
+                std::vector<std::pair<std::shared_ptr<watch>, bool>> ready;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto now = std::chrono::steady_clock::now();
+
+                    for (int i = 0; i < count; ++i)
+                    {
+                        auto it = _watches.find(events[i].data.fd);
+                        if (it == _watches.end()) // The wake up event, or a node removed since
+                            continue;
+
+                        auto w = it->second;
+                        if (w->running)
+                        {
+                            w->pending = true;
+                            continue;
+                        }
+                        w->running = true;
+                        ready.emplace_back(w, false);
+                    }
+
+                    for (auto&& entry : _watches)
+                    {
+                        auto w = entry.second;
+                        if (!w->running && now > w->deadline)
+                        {
+                            w->running = true;
+                            ready.emplace_back(w, true);
+                        }
+                    }
+
+                    for (auto&& entry : ready)
+                        entry.first->runner = std::this_thread::get_id();
+                }
+
+                for (auto&& entry : ready)
+                    dispatch(entry.first, entry.second);
+            }
+        }
+
         v4l_uvc_device::v4l_uvc_device(const uvc_device_info& info, bool use_memory_map)
             : _name(""), _info(),
               _is_capturing(false),
@@ -605,11 +804,15 @@ namespace librealsense
                 throw linux_backend_exception("device is no longer connected!");
 
             _named_mtx = std::unique_ptr<named_mutex>(new named_mutex(_name, 5000));
+#ifdef V4L2_CAPTURE_REACTOR
+            _reactor = v4l_capture_reactor::get_instance();
+#endif
         }
 
         v4l_uvc_device::~v4l_uvc_device()
         {
             _is_capturing = false;
+            if (_reactor) _reactor->remove(_fd);
             if (_thread && _thread->joinable()) _thread->join();
             for (auto&& fd : _fds)
             {
@@ -708,7 +911,18 @@ namespace librealsense
                 streamon();
 
                 _is_capturing = true;
-                _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+                if (_reactor)
+                {
+                    _reactor->add(_fd, [this]() { drain(); }, [this]()
+                    {
+                        LOG_WARNING("Frames didn't arrived within 5 seconds");
+                        librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
+
+                        _error_handler(n);
+                    });
+                }
+                else
+                    _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
             }
         }
 
@@ -722,11 +936,18 @@ namespace librealsense
             _is_capturing = false;
             _is_started = false;
 
-            // Stop nn-demand frames polling
-            signal_stop();
+            if (_reactor)
+            {
+                _reactor->remove(_fd);
+            }
+            else
+            {
+                // Stop nn-demand frames polling
+                signal_stop();
 
-            _thread->join();
-            _thread.reset();
+                _thread->join();
+                _thread.reset();
+            }
 
             // Notify kernel
             streamoff();
@@ -832,93 +1053,140 @@ namespace librealsense
                     }
                     else // Check and acquire data buffers from kernel
                     {
-                        buffers_mgr buf_mgr(_use_memory_map);
-                        // Read metadata from a node
-                        acquire_metadata(buf_mgr,fds);
+                        std::vector<int> ready_fds;
+                        for (auto fd : _fds)
+                            if (FD_ISSET(fd, &fds))
+                                ready_fds.push_back(fd);
 
-                        if(FD_ISSET(_fd, &fds))
-                        {
-                            FD_CLR(_fd,&fds);
-                            v4l2_buffer buf = {};
-                            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                            if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
-                            {
-                                LOG_DEBUG("Dequeued empty buf for fd " << _fd);
-                                if(errno == EAGAIN)
-                                    return;
+                        dequeue_frame(ready_fds);
+                    }
+                }
+                else // (val==0)
+                {
+                    LOG_WARNING("Frames didn't arrived within 5 seconds");
+                        librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
 
-                                throw linux_backend_exception(to_string() << "xioctl(VIDIOC_DQBUF) failed for fd: " << _fd);
-                            }
-                            //LOG_DEBUG("Dequeued buf " << buf.index << " for fd " << _fd);
+                        _error_handler(n);
+                }
+            }
+        }
 
-                            auto buffer = _buffers[buf.index];
-                            buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
+        bool v4l_uvc_device::dequeue_frame(std::vector<int>& ready_fds)
+        {
+            bool md_signalled = ready_fds.size() > 1;
+            buffers_mgr buf_mgr(_use_memory_map);
+            // Read metadata from a node
+            acquire_metadata(buf_mgr,ready_fds);
 
-                            if (_is_started)
-                            {
-                                if(buf.bytesused == 0)
-                                {
-                                    LOG_INFO("Empty video frame arrived");
-                                    return;
-                                }
+            if(take_ready(ready_fds, _fd))
+            {
+                v4l2_buffer buf = {};
+                buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                {
+                    LOG_DEBUG("Dequeued empty buf for fd " << _fd);
+                    if(errno == EAGAIN)
+                        return false;
 
-                                if(_profile.format != 1296715847 && // allow JPEG frames size to be smaller than the uncompressed frame
-                                        (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE))
-                                {
-                                    auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
-                                    std::stringstream s;
-                                    s << "Incomplete video frame detected!\nSize " << buf.bytesused
-                                      << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
-                                    librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
+                    throw linux_backend_exception(to_string() << "xioctl(VIDIOC_DQBUF) failed for fd: " << _fd);
+                }
+                //LOG_DEBUG("Dequeued buf " << buf.index << " for fd " << _fd);
 
-                                    _error_handler(n);
-                                }
-                                else
-                                {
-                                    auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
-                                    timestamp = monotonic_to_realtime(timestamp);
+                auto buffer = _buffers[buf.index];
+                buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
 
-                                    // read metadata from the frame appendix
-                                    acquire_metadata(buf_mgr,fds);
+                if (_is_started)
+                {
+                    if(buf.bytesused == 0)
+                    {
+                        LOG_INFO("Empty video frame arrived");
+                        return true;
+                    }
 
-                                    if (val > 1)
-                                        LOG_INFO("Frame buf ready, md size: " << std::dec << (int)buf_mgr.metadata_size() << " seq. id: " << buf.sequence);
-                                    frame_object fo{ buf.bytesused - MAX_META_DATA_SIZE, buf_mgr.metadata_size(),
-                                        buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+                    if(_profile.format != 1296715847 && // allow JPEG frames size to be smaller than the uncompressed frame
+                            (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE))
+                    {
+                        auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
+                        std::stringstream s;
+                        s << "Incomplete video frame detected!\nSize " << buf.bytesused
+                          << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
+                        librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
 
-                                     buffer->attach_buffer(buf);
-                                     buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
+                        _error_handler(n);
+                    }
+                    else
+                    {
+                        auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
+                        timestamp = monotonic_to_realtime(timestamp);
 
-                                     //Invoke user callback and enqueue next frame
-                                     _callback(_profile, fo,
-                                               [buf_mgr]() mutable {
-                                         buf_mgr.request_next_frame();
-                                     });
-                                }
-                            }
-                            else
-                            {
-                                LOG_INFO("Video frame arrived in idle mode."); // TODO - verification
-                            }
-                        }
-                        else
-                        {
-                            LOG_INFO("FD_ISSET returned false - video node is not signalled (md only)");
-                        }
+                        // read metadata from the frame appendix
+                        acquire_metadata(buf_mgr,ready_fds);
+
+                        if (md_signalled)
+                            LOG_INFO("Frame buf ready, md size: " << std::dec << (int)buf_mgr.metadata_size() << " seq. id: " << buf.sequence);
+                        frame_object fo{ buf.bytesused - MAX_META_DATA_SIZE, buf_mgr.metadata_size(),
+                            buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+
+                         buffer->attach_buffer(buf);
+                         buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
+
+                         //Invoke user callback and enqueue next frame
+                         _callback(_profile, fo,
+                                   [buf_mgr]() mutable {
+                             buf_mgr.request_next_frame();
+                         });
                     }
                 }
-                else // (val==0)
+                else
                 {
-                    LOG_WARNING("Frames didn't arrived within 5 seconds");
-                        librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
+                    LOG_INFO("Video frame arrived in idle mode."); // TODO - verification
+                }
+                return true;
+            }
+            else
+            {
+                LOG_INFO("FD_ISSET returned false - video node is not signalled (md only)");
+                return false;
+            }
+        }
 
-                        _error_handler(n);
+        void v4l_uvc_device::drain()
+        {
+            try
+            {
+                // The nodes are watched edge-triggered, every frame ready is dequeued before waiting again
+                std::vector<int> ready_fds;
+                do
+                {
+                    ready_fds.clear();
+                    for (auto fd : _fds)
+                        if (fd != _stop_pipe_fd[0] && fd != _stop_pipe_fd[1])
+                            ready_fds.push_back(fd);
                 }
+                while (_is_capturing && dequeue_frame(ready_fds));
             }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR(ex.what());
+
+                librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_ERROR, ex.what()};
+
+                _error_handler(n);
+            }
+        }
+
+        bool v4l_uvc_device::take_ready(std::vector<int>& ready_fds, int fd)
+        {
+            auto it = std::find(ready_fds.begin(), ready_fds.end(), fd);
+            if (it == ready_fds.end())
+                return false;
+
+            ready_fds.erase(it);
+            return true;
         }
 
-        void v4l_uvc_device::acquire_metadata(buffers_mgr & buf_mgr,fd_set &)
+        void v4l_uvc_device::acquire_metadata(buffers_mgr & buf_mgr,std::vector<int> &)
         {
             if (has_metadata())
                 buf_mgr.set_md_from_video_node();
@@ -1507,15 +1775,14 @@ namespace librealsense
         }
 
         // retrieve metadata from a dedicated UVC node
-        void v4l_uvc_meta_device::acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds)
+        void v4l_uvc_meta_device::acquire_metadata(buffers_mgr & buf_mgr,std::vector<int> &ready_fds)
         {
             // Metadata is calculated once per frame
             if (buf_mgr.metadata_size())
                 return;
 
-            if(FD_ISSET(_md_fd, &fds))
+            if(take_ready(ready_fds, _md_fd))
             {
-                FD_CLR(_md_fd,&fds);
                 v4l2_buffer buf{};
                 buf.type = LOCAL_V4L2_BUF_TYPE_META_CAPTURE;
                 buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
@@ -1616,9 +1883,84 @@ namespace librealsense
             return std::make_shared<os_time_service>();
         }
 
+        netlink_uevent_source::netlink_uevent_source()
+            : _fd(-1), _buffer(8192)
+        {
+            _fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+            if (_fd < 0)
+                throw linux_backend_exception("netlink uevent socket failed");
+
+            // Group 1 carries the kernel events, udev rebroadcasts on group 2
+            sockaddr_nl addr = {};
+            addr.nl_family = AF_NETLINK;
+            addr.nl_pid = 0;
+            addr.nl_groups = 1;
+            if (bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+            {
+                ::close(_fd);
+                throw linux_backend_exception("netlink uevent bind failed");
+            }
+        }
+
+        netlink_uevent_source::~netlink_uevent_source()
+        {
+            ::close(_fd);
+        }
+
+        bool netlink_uevent_source::next(uevent& ev, int timeout_ms)
+        {
+            using namespace std::chrono;
+            auto deadline = steady_clock::now() + milliseconds(timeout_ms);
+            while (true)
+            {
+                auto remaining = duration_cast<milliseconds>(deadline - steady_clock::now()).count();
+                pollfd pfd = { _fd, POLLIN, 0 };
+                auto res = ::poll(&pfd, 1, std::max<int>(0, static_cast<int>(remaining)));
+                if (res < 0 && errno == EINTR)
+                    continue;
+                if (res <= 0)
+                    return false;
+
+                // Only the kernel may send on the uevent group, anything else is dropped
+                sockaddr_nl sender = {};
+                iovec iov = { _buffer.data(), _buffer.size() };
+                msghdr msg = {};
+                msg.msg_name = &sender;
+                msg.msg_namelen = sizeof(sender);
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                auto len = recvmsg(_fd, &msg, MSG_DONTWAIT);
+                if (len < 0)
+                {
+                    if (errno == ENOBUFS)
+                    {
+                        LOG_WARNING("Device events were lost, querying all the devices");
+                        ev = uevent();
+                        ev.action = "resync";
+                        return true;
+                    }
+                    if (errno == EAGAIN || errno == EINTR)
+                        continue;
+                    LOG_WARNING("netlink uevent receive failed, error " << errno);
+                    return false;
+                }
+
+                if (sender.nl_pid == 0 && parse_uevent(_buffer.data(), static_cast<size_t>(len), ev))
+                    return true;
+            }
+        }
+
         std::shared_ptr<device_watcher> v4l_backend::create_device_watcher() const
         {
-            return std::make_shared<polling_device_watcher>(this);
+            try
+            {
+                return std::make_shared<uevent_device_watcher>(this, std::make_shared<netlink_uevent_source>());
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_WARNING("Device events are not available, polling the devices instead: " << ex.what());
+                return std::make_shared<polling_device_watcher>(this);
+            }
         }
 
         std::shared_ptr<backend> create_backend()
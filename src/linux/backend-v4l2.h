@@ -5,6 +5,7 @@
 
 #include "backend.h"
 #include "types.h"
+#include "uevent-device-watcher.h"
 
 #include <cassert>
 #include <cstdlib>
@@ -23,6 +24,8 @@
 #include <chrono>
 #include <thread>
 #include <atomic>
+#include <condition_variable>
+#include <map>
 
 #include <dirent.h>
 #include <fcntl.h>
@@ -220,6 +223,50 @@ namespace librealsense
             std::array<kernel_buf_guard, e_max_kernel_buf_type> buffers;
         };
 
+        // Captures the streams of many V4L2 devices from a few shared threads, in place of a thread per stream.
+        // The devices register the nodes they stream from, with a handler run on a reactor thread whenever the node
+        // becomes readable. The nodes are watched edge-triggered and one shot, so that a handler runs on one thread
+        // at a time and is expected to dequeue every ready buffer before returning. on_timeout is run instead after
+        // five seconds without readiness
+        class v4l_capture_reactor
+        {
+        public:
+            // Shared by all the devices streaming at once, with V4L2_CAPTURE_REACTOR_THREADS threads
+            static std::shared_ptr<v4l_capture_reactor> get_instance();
+
+            explicit v4l_capture_reactor(int threads);
+            ~v4l_capture_reactor();
+
+            void add(int fd, std::function<void()> on_ready, std::function<void()> on_timeout);
+
+            // Stops watching fd, once its running handler returned unless called from it
+            void remove(int fd);
+
+        private:
+            struct watch
+            {
+                int fd;
+                std::function<void()> on_ready;
+                std::function<void()> on_timeout;
+                std::chrono::steady_clock::time_point deadline;
+                bool running = false;
+                bool pending = false;   // Signalled while its timeout handler ran
+                std::thread::id runner;
+            };
+
+            void run();
+            void dispatch(std::shared_ptr<watch> w, bool timed_out);
+            void rearm(const watch& w);
+
+            int _epoll_fd;
+            int _wake_fd;
+            std::atomic<bool> _is_running;
+            std::mutex _mutex;
+            std::condition_variable _handler_done;
+            std::map<int, std::shared_ptr<watch>> _watches;
+            std::vector<std::thread> _threads;
+        };
+
         class v4l_uvc_interface
         {
             virtual void capture_loop() = 0;
@@ -236,7 +283,7 @@ namespace librealsense
             virtual void set_format(stream_profile profile) = 0;
             virtual void prepare_capture_buffers() = 0;
             virtual void stop_data_capture() = 0;
-            virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds) = 0;
+            virtual void acquire_metadata(buffers_mgr & buf_mgr,std::vector<int> &ready_fds) = 0;
         };
 
         class v4l_uvc_device : public uvc_device, public v4l_uvc_interface
@@ -266,6 +313,12 @@ namespace librealsense
 
             void poll();
 
+            // Dequeues the frame of the ready nodes, returns whether a video buffer was dequeued
+            bool dequeue_frame(std::vector<int>& ready_fds);
+
+            // Dequeues the frames until none is ready, the capture reactor handler
+            void drain();
+
             void set_power_state(power_state state) override;
             power_state get_power_state() const override { return _state; }
 
@@ -288,6 +341,9 @@ namespace librealsense
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
 
+            // The buffers are queued back to the kernel by the frame continuation
+            bool retains_frame_buffers() const override { return true; }
+
         protected:
             static uint32_t get_cid(rs2_option option);
 
@@ -305,7 +361,10 @@ namespace librealsense
             virtual void set_format(stream_profile profile) override;
             virtual void prepare_capture_buffers() override;
             virtual void stop_data_capture() override;
-            virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds) override;
+            virtual void acquire_metadata(buffers_mgr & buf_mgr,std::vector<int> &ready_fds) override;
+
+            // Removes fd from the ready nodes, returns whether it was there
+            static bool take_ready(std::vector<int>& ready_fds, int fd);
 
             power_state _state = D3;
             std::string _name = "";
@@ -320,6 +379,7 @@ namespace librealsense
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
             std::unique_ptr<std::thread> _thread;
+            std::shared_ptr<v4l_capture_reactor> _reactor;  // Captures in place of _thread when set
             std::unique_ptr<named_mutex> _named_mtx;
             bool _use_memory_map;
             int _max_fd = 0;                    // specifies the maximal pipe number the polling process will monitor
@@ -349,7 +409,7 @@ namespace librealsense
             void unmap_device_descriptor();
             void set_format(stream_profile profile);
             void prepare_capture_buffers();
-            virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds);
+            virtual void acquire_metadata(buffers_mgr & buf_mgr,std::vector<int> &ready_fds);
 
             int _md_fd = -1;
             std::string _md_name = "";
@@ -358,6 +418,20 @@ namespace librealsense
             stream_profile _md_profile;
         };
 
+        // Kernel object events of the NETLINK_KOBJECT_UEVENT socket, as udev receives them
+        class netlink_uevent_source : public uevent_source
+        {
+        public:
+            netlink_uevent_source();
+            ~netlink_uevent_source();
+
+            bool next(uevent& ev, int timeout_ms) override;
+
+        private:
+            int _fd;
+            std::vector<char> _buffer;
+        };
+
         class v4l_backend : public backend
         {
         public:
@@ -346,6 +346,7 @@ namespace librealsense
             void unlock() const override;
             std::string get_device_location() const override;
             usb_spec get_usb_specification() const override;
+            bool retains_frame_buffers() const override { return _source->retains_frame_buffers(); }
 
             explicit record_uvc_device(
                 std::shared_ptr<uvc_device> source,
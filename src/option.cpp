@@ -41,28 +41,54 @@ void librealsense::float_option::set(float value)
     _value = value;
 }
 
+bool librealsense::uvc_pu_option::is_cacheable() const
+{
+    // The device changes these on its own while their auto control is on
+    return _id != RS2_OPTION_EXPOSURE && _id != RS2_OPTION_GAIN && _id != RS2_OPTION_WHITE_BALANCE;
+}
+
 void librealsense::uvc_pu_option::set(float value)
 {
-    _ep.invoke_powered(
-        [this, value](platform::uvc_device& dev)
-        {
-            if (!dev.set_pu(_id, static_cast<int32_t>(value)))
-                throw invalid_value_exception(to_string() << "set_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-            _record(*this);
-        });
+    auto write = [this, value]()
+    {
+        _ep.invoke_powered(
+            [this, value](platform::uvc_device& dev)
+            {
+                if (!dev.set_pu(_id, static_cast<int32_t>(value)))
+                    throw invalid_value_exception(to_string() << "set_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+                _record(*this);
+            });
+    };
+
+    if (is_cacheable())
+        _ep.get_option_cache().set(this, static_cast<float>(static_cast<int32_t>(value)), write);
+    else
+    {
+        // Setting a control may change the others, such as a manual exposure turning the auto exposure off
+        write();
+        _ep.get_option_cache().invalidate();
+    }
 }
 
 float librealsense::uvc_pu_option::query() const
 {
-    return static_cast<float>(_ep.invoke_powered(
-        [this](platform::uvc_device& dev)
-        {
-            int32_t value = 0;
-            if (!dev.get_pu(_id, value))
-                throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+    // The read may run in the background, it holds on to the sensor that owns the cache rather than to the option
+    auto ep = &_ep;
+    auto id = _id;
+    auto read = [ep, id]()
+    {
+        return static_cast<float>(ep->invoke_powered(
+            [id](platform::uvc_device& dev)
+            {
+                int32_t value = 0;
+                if (!dev.get_pu(id, value))
+                    throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(id) << ") failed!" << " Last Error: " << strerror(errno));
+
+                return static_cast<float>(value);
+            }));
+    };
 
-            return static_cast<float>(value);
-        }));
+    return _ep.get_option_cache().query(this, read, is_cacheable());
 }
 
 librealsense::option_range librealsense::uvc_pu_option::get_range() const
@@ -220,6 +220,8 @@ namespace librealsense
             _record = record_action;
         }
     private:
+        bool is_cacheable() const;
+
         uvc_sensor& _ep;
         rs2_option _id;
         const std::map<float, std::string> _description_per_value;
@@ -232,27 +234,47 @@ namespace librealsense
     public:
         void set(float value) override
         {
-            _ep.invoke_powered(
-                [this, value](platform::uvc_device& dev)
-                {
-                    T t = static_cast<T>(value);
-                    if (!dev.set_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
-                        throw invalid_value_exception(to_string() << "set_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-                    _recording_function(*this);
-                });
+            auto write = [this, value]()
+            {
+                _ep.invoke_powered(
+                    [this, value](platform::uvc_device& dev)
+                    {
+                        T t = static_cast<T>(value);
+                        if (!dev.set_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
+                            throw invalid_value_exception(to_string() << "set_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+                        _recording_function(*this);
+                    });
+            };
+
+            if (_cacheable)
+                _ep.get_option_cache().set(this, static_cast<float>(static_cast<T>(value)), write);
+            else
+            {
+                write();
+                _ep.get_option_cache().invalidate();
+            }
         }
 
         float query() const override
         {
-            return static_cast<float>(_ep.invoke_powered(
-                [this](platform::uvc_device& dev)
-                {
-                    T t;
-                    if (!dev.get_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
-                        throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-
-                    return static_cast<float>(t);
-                }));
+            // The read may run in the background, it holds on to the sensor that owns the cache rather than to the option
+            auto ep = &_ep;
+            auto xu = _xu;
+            auto id = _id;
+            auto read = [ep, xu, id]()
+            {
+                return static_cast<float>(ep->invoke_powered(
+                    [&xu, id](platform::uvc_device& dev)
+                    {
+                        T t;
+                        if (!dev.get_xu(xu, id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
+                            throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(id) << ") failed!" << " Last Error: " << strerror(errno));
+
+                        return static_cast<float>(t);
+                    }));
+            };
+
+            return _ep.get_option_cache().query(this, read, _cacheable);
         }
 
         option_range get_range() const override
@@ -277,12 +299,13 @@ namespace librealsense
 
         bool is_enabled() const override { return true; }
 
-        uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description)
-            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description))
+        // A cacheable control is one the device changes only when it is set, its value is kept in the cache of the sensor
+        uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description, bool cacheable = false)
+            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description)), _cacheable(cacheable)
         {}
 
-        uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description, const std::map<float, std::string>& description_per_value)
-            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description)), _description_per_value(description_per_value)
+        uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description, const std::map<float, std::string>& description_per_value, bool cacheable = false)
+            : _ep(ep), _xu(xu), _id(id), _desciption(std::move(description)), _description_per_value(description_per_value), _cacheable(cacheable)
         {}
 
         const char* get_description() const override
@@ -306,6 +329,7 @@ namespace librealsense
         std::string         _desciption;
         std::function<void(const option&)> _recording_function = [](const option&) {};
         const std::map<float, std::string> _description_per_value;
+        bool                _cacheable;
     };
 
     template<class T, class R, class W, class U>
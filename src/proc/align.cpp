@@ -15,50 +15,99 @@ namespace librealsense
 {
     template<int N> struct bytes { byte b[N]; };
 
-    template<class GET_DEPTH, class TRANSFER_PIXEL>
-    void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
-        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
+    // Depth rows handled per task; small enough to balance, large enough to amortize scheduling
+    static const int ALIGN_ROWS_PER_TASK = 8;
+
+    // Map the footprint of every depth pixel onto the other image. Pixels without depth, or
+    // whose footprint leaves the other image, get an empty rectangle (top-left past bottom-right).
+    // The range of other-image rows touched by each depth row is kept for the splatting stage
+    void map_depth_to_other(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
+        const rs2_intrinsics& other_intrin, const uint16_t* z_pixels, float z_scale, align_map& map, thread_pool& pool)
     {
-        // Iterate over the pixels of the depth image
-#pragma omp parallel for schedule(dynamic)
-        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        const int2 empty_top_left = { 1, 1 }, empty_bottom_right = { 0, 0 };
+
+        map.top_left.resize(depth_intrin.width * depth_intrin.height);
+        map.bottom_right.resize(depth_intrin.width * depth_intrin.height);
+        map.row_span.resize(depth_intrin.height);
+
+        pool.parallel_for(0, depth_intrin.height, [&](int first, int last)
         {
-            int depth_pixel_index = depth_y * depth_intrin.width;
-            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            for (int depth_y = first; depth_y < last; ++depth_y)
             {
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (float depth = get_depth(depth_pixel_index))
+                int2 span = { other_intrin.height, -1 };
+                int depth_pixel_index = depth_y * depth_intrin.width;
+                for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
                 {
-                    // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
-                        continue;
-
-                    // Transfer between the depth pixels and the pixels inside the rectangle on the other image
-                    for (int y = other_y0; y <= other_y1; ++y)
+                    map.top_left[depth_pixel_index] = empty_top_left;
+                    map.bottom_right[depth_pixel_index] = empty_bottom_right;
+
+                    // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+                    if (float depth = z_scale * z_pixels[depth_pixel_index])
                     {
-                        for (int x = other_x0; x <= other_x1; ++x)
+                        // Map the top-left corner of the depth pixel onto the other image
+                        float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
+                        rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                        rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        // Map the bottom-right corner of the depth pixel onto the other image
+                        depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
+                        rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                        rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                            continue;
+
+                        map.top_left[depth_pixel_index] = { other_x0, other_y0 };
+                        map.bottom_right[depth_pixel_index] = { other_x1, other_y1 };
+                        if (other_x0 <= other_x1 && other_y0 <= other_y1)
                         {
-                            transfer_pixel(depth_pixel_index, y * other_intrin.width + x);
+                            span.x = std::min(span.x, other_y0);
+                            span.y = std::max(span.y, other_y1);
                         }
                     }
                 }
+                map.row_span[depth_y] = span;
             }
-        }
+        }, ALIGN_ROWS_PER_TASK);
+    }
+
+    // Splat depth into the other image. The other image is split into bands of rows, each band
+    // owned by a single task acting as its z-buffer, so overlapping footprints coming from
+    // different depth rows resolve to the nearest depth regardless of scheduling
+    void splat_depth_to_other(const uint16_t* z_pixels, uint16_t* out_z, const rs2_intrinsics& depth_intrin,
+        const rs2_intrinsics& other_intrin, const align_map& map, thread_pool& pool)
+    {
+        pool.parallel_for(0, other_intrin.height, [&](int band_first, int band_last)
+        {
+            for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+            {
+                auto&& span = map.row_span[depth_y];
+                if (span.y < band_first || span.x >= band_last)
+                    continue;
+
+                int depth_pixel_index = depth_y * depth_intrin.width;
+                for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+                {
+                    auto&& tl = map.top_left[depth_pixel_index];
+                    auto&& br = map.bottom_right[depth_pixel_index];
+                    auto z = z_pixels[depth_pixel_index];
+                    for (int y = std::max(tl.y, band_first); y <= std::min(br.y, band_last - 1); ++y)
+                    {
+                        for (int x = tl.x; x <= br.x; ++x)
+                        {
+                            auto& out = out_z[y * other_intrin.width + x];
+                            out = out ? std::min(out, z) : z;
+                        }
+                    }
+                }
+            }
+        }, ALIGN_ROWS_PER_TASK);
     }
 
     align::align(rs2_stream to_stream) : align(to_stream, "Align")
@@ -80,44 +129,48 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
-            [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
-        {
-            out_z[other_pixel_index] = out_z[other_pixel_index] ?
-                std::min((int)out_z[other_pixel_index], (int)z_pixels[z_pixel_index]) :
-                z_pixels[z_pixel_index];
-        });
+        map_depth_to_other(z_intrin, z_to_other, other_intrin, z_pixels, z_scale, _map);
+        splat_depth_to_other(z_pixels, out_z, z_intrin, other_intrin, _map);
     }
 
-    template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels)
+    template<int N>
+    void align_other_to_depth_bytes(byte* other_aligned_to_depth, const rs2_intrinsics& depth_intrin, const rs2_intrinsics& other_intrin, const byte* other_pixels, const align_map& map, thread_pool& pool)
     {
         auto in_other = (const bytes<N> *)(other_pixels);
         auto out_other = (bytes<N> *)(other_aligned_to_depth);
-        align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
-            [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
+
+        // Every depth pixel only writes its own output pixel, so rows are processed independently.
+        // Of the footprint rectangle, its bottom-right pixel is the one that ends up in the output
+        pool.parallel_for(0, depth_intrin.height, [&](int first, int last)
+        {
+            for (int depth_pixel_index = first * depth_intrin.width; depth_pixel_index < last * depth_intrin.width; ++depth_pixel_index)
+            {
+                auto&& tl = map.top_left[depth_pixel_index];
+                auto&& br = map.bottom_right[depth_pixel_index];
+                if (tl.x <= br.x && tl.y <= br.y)
+                    out_other[depth_pixel_index] = in_other[br.y * other_intrin.width + br.x];
+            }
+        }, ALIGN_ROWS_PER_TASK);
     }
 
-    template<class GET_DEPTH>
-    void align_other_to_depth(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels, rs2_format other_format)
+    void align_other_to_depth(byte* other_aligned_to_depth, const rs2_intrinsics& depth_intrin, const rs2_intrinsics& other_intrin, const byte* other_pixels, rs2_format other_format, const align_map& map, thread_pool& pool)
     {
         switch (other_format)
         {
         case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<1>(other_aligned_to_depth, depth_intrin, other_intrin, other_pixels, map, pool);
             break;
         case RS2_FORMAT_Y16:
         case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<2>(other_aligned_to_depth, depth_intrin, other_intrin, other_pixels, map, pool);
             break;
         case RS2_FORMAT_RGB8:
         case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<3>(other_aligned_to_depth, depth_intrin, other_intrin, other_pixels, map, pool);
             break;
         case RS2_FORMAT_RGBA8:
         case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<4>(other_aligned_to_depth, depth_intrin, other_intrin, other_pixels, map, pool);
             break;
         default:
             assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
@@ -140,8 +193,8 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto other_pixels = reinterpret_cast<const byte*>(other.get_data());
 
-        align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+        map_depth_to_other(z_intrin, z_to_other, other_intrin, z_pixels, z_scale, _map);
+        align_other_to_depth(aligned_data, z_intrin, other_intrin, other_pixels, other_profile.format(), _map);
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
@@ -258,6 +311,24 @@ namespace librealsense
 
         _depth_scale = ((librealsense::depth_frame*)depth.get())->get_units();
 
+        // The depth of the region of interest is aligned from a copy of it, the cached mappings follow the region
+        auto full_depth = depth;
+        auto rect = _roi.get(depth.get_width(), depth.get_height());
+        if (!(rect == _roi_rect))
+        {
+            _roi_rect = rect;
+            _align_stream_unique_ids.clear();
+            reset_cache(RS2_STREAM_DEPTH, _to_stream_type);
+        }
+        if (_roi.is_set())
+            depth = _roi.crop_frame(source, depth, rect, RS2_EXTENSION_DEPTH_FRAME).as<rs2::depth_frame>();
+        // The aligned profiles are keyed by the address of the cropped profiles, which go with them
+        if (_roi.released_profiles() != _roi_released_profiles)
+        {
+            _roi_released_profiles = _roi.released_profiles();
+            _align_stream_unique_ids.clear();
+        }
+
         if (_to_stream_type == RS2_STREAM_DEPTH)
             frames.foreach_rs([&other_frames](const rs2::frame& f) {if ((f.get_profile().stream_type() != RS2_STREAM_DEPTH) && f.is<rs2::video_frame>()) other_frames.push_back(f); });
         else
@@ -269,6 +340,18 @@ namespace librealsense
             {
                 auto aligned_frame = allocate_aligned_frame(source, from, depth);
                 align_frames(aligned_frame, from, depth);
+
+                // Without cropping the aligned region takes its place in a frame of the whole depth
+                if (_roi.is_set() && !_roi.crop())
+                {
+                    auto full_frame = allocate_aligned_frame(source, from, full_depth);
+                    auto bpp = full_frame.get_bytes_per_pixel();
+                    auto data = static_cast<uint8_t*>(const_cast<void*>(full_frame.get_data()));
+                    memset(data, 0, full_frame.get_height() * full_frame.get_stride_in_bytes());
+                    copy_rows(data + rect.y * full_frame.get_stride_in_bytes() + rect.x * bpp, full_frame.get_stride_in_bytes(),
+                        aligned_frame.get_data(), aligned_frame.get_stride_in_bytes(), rect.width * bpp, rect.height);
+                    aligned_frame = full_frame;
+                }
                 output_frames.push_back(aligned_frame);
             }
         }
@@ -6,12 +6,31 @@
 #include <map>
 #include <utility>
 #include "core/processing.h"
+#include "concurrency.h"
 #include "proc/synthetic-stream.h"
+#include "proc/processing-roi.h"
 #include "image.h"
 #include "source.h"
 
 namespace librealsense
 {
+    // Footprint of each depth pixel on the other image, as computed by the scalar align path,
+    // and per depth row the first (x) and last (y) rows of the other image it touches
+    struct align_map
+    {
+        std::vector<int2> top_left;
+        std::vector<int2> bottom_right;
+        std::vector<int2> row_span;
+    };
+
+    // Stages of the scalar align path, split into tasks on the given pool
+    void map_depth_to_other(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin,
+        const uint16_t* z_pixels, float z_scale, align_map& map, thread_pool& pool = thread_pool::get_default());
+    void splat_depth_to_other(const uint16_t* z_pixels, uint16_t* out_z, const rs2_intrinsics& depth_intrin,
+        const rs2_intrinsics& other_intrin, const align_map& map, thread_pool& pool = thread_pool::get_default());
+    void align_other_to_depth(byte* other_aligned_to_depth, const rs2_intrinsics& depth_intrin, const rs2_intrinsics& other_intrin,
+        const byte* other_pixels, rs2_format other_format, const align_map& map, thread_pool& pool = thread_pool::get_default());
+
     class LRS_EXTENSION_API align : public generic_processing_block
     {
     public:
@@ -20,7 +39,8 @@ namespace librealsense
     protected:
         align(rs2_stream to_stream, const char* name)
             : generic_processing_block(name), 
-              _to_stream_type(to_stream), _depth_scale(0)
+              _to_stream_type(to_stream), _depth_scale(0),
+              _roi(*this, _mutex), _roi_rect{}
         {}
 
         bool should_process(const rs2::frame& frame) override;
@@ -48,6 +68,13 @@ namespace librealsense
         std::map<std::pair<stream_profile_interface*, stream_profile_interface*>, std::shared_ptr<rs2::video_stream_profile>> _align_stream_unique_ids;
         rs2::stream_profile _source_stream_profile;
         float _depth_scale;
+        align_map _map;
+
+        // Only the depth pixels of the region of interest are aligned, the other frames aligned to depth are
+        // cropped to it when cropping. Depth aligned to another stream keeps the resolution of that stream
+        processing_roi _roi;
+        pixel_rect _roi_rect;
+        size_t _roi_released_profiles = 0;
 
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
@@ -214,6 +214,69 @@ namespace librealsense
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
     }
 
+    void colorizer::update_fixed_lut()
+    {
+        if (_lut_valid && _lut_map_index == _map_index && _lut_min == _min &&
+            _lut_max == _max && _lut_depth_units == _depth_units)
+            return;
+
+        auto cm = _maps[_map_index];
+        auto min = _min;
+        auto max = _max;
+        auto coloring_function = [&, this](float data) {
+            return (data * _depth_units - min) / (max - min);
+        };
+
+        _lut.resize(MAX_DEPTH * 3);
+        auto lut = _lut.data();
+        for (auto i = 0; i < MAX_DEPTH; ++i)
+            colorize_pixel(lut, i, cm, static_cast<uint16_t>(i), coloring_function);
+
+        _lut_valid = true;
+        _lut_map_index = _map_index;
+        _lut_min = _min;
+        _lut_max = _max;
+        _lut_depth_units = _depth_units;
+    }
+
+    void colorizer::update_equalized_lut()
+    {
+        auto cm = _maps[_map_index];
+        auto coloring_function = [&, this](float data) {
+            auto hist_data = _hist_data[(int)data];
+            auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+            return (hist_data / pixels);
+        };
+
+        _lut.resize(MAX_DEPTH * 3);
+        auto lut = _lut.data();
+        thread_pool::get_default().parallel_for(0, MAX_DEPTH, [&](int first, int last)
+        {
+            for (auto i = first; i < last; ++i)
+                colorize_pixel(lut, i, cm, static_cast<uint16_t>(i), coloring_function);
+        }, 0x1000);
+
+        // The table now follows the histogram, a fixed-range frame has to rebuild it
+        _lut_valid = false;
+    }
+
+    void colorizer::make_rgb_data_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto lut = _lut.data();
+        thread_pool::get_default().parallel_for(0, height, [&](int first, int last)
+        {
+            auto out = rgb_data + first * width * 3;
+            auto end = depth_data + last * width;
+            for (auto in = depth_data + first * width; in < end; ++in, out += 3)
+            {
+                auto c = lut + *in * 3;
+                out[0] = c[0];
+                out[1] = c[1];
+                out[2] = c[2];
+            }
+        }, MIN_ROWS_PER_BAND);
+    }
+
     bool colorizer::should_process(const rs2::frame& frame)
     {
         if (!frame || frame.is<rs2::frameset>())
@@ -258,7 +321,8 @@ namespace librealsense
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
                 update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_equalized_lut();
+                make_rgb_data_lut(depth_data, rgb_data, w, h);
             }
         };
 
@@ -285,12 +349,8 @@ namespace librealsense
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                auto min = _min;
-                auto max = _max;
-                auto coloring_function = [&, this](float data) {
-                    return (data * _depth_units - min) / (max - min);
-                };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_fixed_lut();
+                make_rgb_data_lut(depth_data, rgb_data, w, h);
             }
         };
 
@@ -6,6 +6,8 @@
 #include <map>
 #include <vector>
 
+#include "concurrency.h"
+
 namespace rs2
 {
     class stream_profile;
@@ -103,12 +105,48 @@ namespace librealsense {
         template<typename T>
         static void update_histogram(int* hist, const T* depth_data, int w, int h)
         {
-            memset(hist, 0, MAX_DEPTH * sizeof(int));
-            for (auto i = 0; i < w*h; ++i)
+            // Every band of rows accumulates into its own partial histogram,
+            // the partials are then summed bin-wise, avoiding contended writes
+            auto& pool = thread_pool::get_default();
+            auto bands = std::min<int>(static_cast<int>(pool.size()), h / MIN_ROWS_PER_BAND);
+            if (bands <= 1)
+            {
+                memset(hist, 0, MAX_DEPTH * sizeof(int));
+                for (auto i = 0; i < w*h; ++i)
+                {
+                    T depth_val = depth_data[i];
+                    int index = depth_val;
+                    hist[index] += 1;
+                }
+            }
+            else
             {
-                T depth_val = depth_data[i];
-                int index = depth_val;
-                hist[index] += 1;
+                std::vector<std::vector<int>> partials(bands);
+                pool.parallel_for(0, bands, [&](int first, int last)
+                {
+                    for (auto b = first; b < last; ++b)
+                    {
+                        auto& partial = partials[b];
+                        partial.assign(MAX_DEPTH, 0);
+                        auto begin = depth_data + (int64_t)w * (h * b / bands);
+                        auto end = depth_data + (int64_t)w * (h * (b + 1) / bands);
+                        for (auto p = begin; p < end; ++p)
+                        {
+                            int index = static_cast<int>(*p);
+                            partial[index] += 1;
+                        }
+                    }
+                });
+                pool.parallel_for(0, MAX_DEPTH, [&](int first, int last)
+                {
+                    for (auto i = first; i < last; ++i)
+                    {
+                        int sum = 0;
+                        for (auto&& partial : partials)
+                            sum += partial[i];
+                        hist[i] = sum;
+                    }
+                }, 0x1000);
             }
 
             for (auto i = 2; i < MAX_DEPTH; ++i) hist[i] += hist[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
@@ -116,6 +154,7 @@ namespace librealsense {
 
         static const int MAX_DEPTH = 0x10000;
         static const int MAX_DISPARITY = 0x2710;
+        static const int MIN_ROWS_PER_BAND = 16;
 
     protected:
         colorizer(const char* name);
@@ -127,13 +166,23 @@ namespace librealsense {
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
             auto cm = _maps[_map_index];
-            for (auto i = 0; i < width*height; ++i)
+            thread_pool::get_default().parallel_for(0, height, [&](int first, int last)
             {
-                auto d = depth_data[i];
-                colorize_pixel(rgb_data, i, cm, d, coloring_func);
-            }
+                for (auto i = first * width; i < last * width; ++i)
+                {
+                    auto d = depth_data[i];
+                    colorize_pixel(rgb_data, i, cm, d, coloring_func);
+                }
+            }, MIN_ROWS_PER_BAND);
         }
 
+        // Colorize Z16 data through the 64K-entry look-up table prepared by
+        // update_fixed_lut / update_equalized_lut
+        void make_rgb_data_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
+        void update_fixed_lut();
+        void update_equalized_lut();
+
         template<typename T, typename F>
         void colorize_pixel(uint8_t* rgb_data, int idx, color_map* cm, T data, F coloring_func)
         {
@@ -168,5 +217,15 @@ namespace librealsense {
 
         float   _depth_units = 0.f;
         float   _d2d_convert_factor = 0.f;
+
+        // RGB triplet per Z16 value. For the fixed range the table is valid as long
+        // as the map, range and depth units are unchanged; equalized tables depend
+        // on the histogram and are rebuilt on every frame
+        std::vector<uint8_t> _lut;
+        bool    _lut_valid = false;
+        int     _lut_map_index = -1;
+        float   _lut_min = 0.f;
+        float   _lut_max = 0.f;
+        float   _lut_depth_units = 0.f;
     };
 }
@@ -210,7 +210,9 @@ namespace librealsense
         _padded_width(0),
         _padded_height(0),
         _recalc_profile(false),
-        _options_changed(false)
+        _options_changed(false),
+        _roi(*this, _mutex, [this]() { _options_changed = true; }),
+        _roi_rect{}
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -258,18 +260,47 @@ namespace librealsense
 
         if (auto tgt = prepare_target_frame(f, source, tgt_type))
         {
+            // Only the patches of the region of interest are decimated
+            auto bpp = src.get_bytes_per_pixel();
+            auto in = static_cast<const uint8_t*>(src.get_data()) + (_roi_rect.y * src.get_width() + _roi_rect.x) * bpp;
+            auto out = const_cast<void*>(tgt.get_data());
+
+            // Without cropping the decimated region goes to its place in an otherwise empty frame
+            bool uncropped = _roi.is_set() && !_roi.crop();
+            auto real_width = _real_width, real_height = _real_height, padded_width = _padded_width, padded_height = _padded_height;
+            if (uncropped)
+            {
+                _padded_width = _real_width = _roi_rect.width / _patch_size;
+                _padded_height = _real_height = _roi_rect.height / _patch_size;
+                _roi_buffer.resize(_real_width * _real_height * bpp);
+                out = _roi_buffer.data();
+            }
+
             if (format == RS2_FORMAT_Z16)
             {
-                decimate_depth(static_cast<const uint16_t*>(src.get_data()),
-                    static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
+                decimate_depth(reinterpret_cast<const uint16_t*>(in),
+                    static_cast<uint16_t*>(out),
                     src.get_width(), src.get_height(), this->_patch_size);
             }
             else
             {
-                decimate_others(format, src.get_data(),
-                    const_cast<void*>(tgt.get_data()),
+                decimate_others(format, in, out,
                     src.get_width(), src.get_height(), this->_patch_size);
             }
+
+            if (uncropped)
+            {
+                auto roi_width = _real_width, roi_height = _real_height;
+                _real_width = real_width;
+                _real_height = real_height;
+                _padded_width = padded_width;
+                _padded_height = padded_height;
+
+                auto data = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+                memset(data, 0, _padded_width * _padded_height * bpp);
+                copy_rows(data + ((_roi_rect.y / _patch_size) * _padded_width + _roi_rect.x / _patch_size) * bpp, _padded_width * bpp,
+                    _roi_buffer.data(), roi_width * bpp, roi_width * bpp, roi_height);
+            }
             return tgt;
         }
         return f;
@@ -281,7 +312,15 @@ namespace librealsense
         {
             _options_changed = false;
             _source_stream_profile = f.get_profile();
-            const auto pf = _registered_profiles.find(std::make_tuple(_source_stream_profile.get(), _decimation_factor));
+
+            // The region of interest is made of whole patches, and of whole macro-pixels for the YUV formats
+            auto format = _source_stream_profile.format();
+            auto vp = _source_stream_profile.as<rs2::video_stream_profile>();
+            int cell = _patch_size * ((format == RS2_FORMAT_YUYV || format == RS2_FORMAT_UYVY) ? 2 : 1);
+            _roi_rect = _roi.get(vp.width(), vp.height(), cell);
+
+            // Cropped profiles follow the region and are not kept
+            const auto pf = _roi.crop() ? _registered_profiles.end() : _registered_profiles.find(std::make_tuple(_source_stream_profile.get(), _decimation_factor));
             if (_registered_profiles.end() != pf)
             {
                 _target_stream_profile = pf->second;
@@ -312,9 +351,10 @@ namespace librealsense
             rs2_intrinsics src_intrin = src_vspi->get_intrinsics();
             rs2_intrinsics tgt_intrin = tgt_vspi->get_intrinsics();
 
-            // recalculate real/padded output frame size based on new input porperties
-            _real_width = src_vspi->get_width() / _patch_size;
-            _real_height = src_vspi->get_height() / _patch_size;
+            // recalculate real/padded output frame size based on new input porperties, the region of interest when cropping
+            auto origin = _roi.crop() ? _roi_rect : pixel_rect{ 0, 0, int(src_vspi->get_width()), int(src_vspi->get_height()) };
+            _real_width = origin.width / _patch_size;
+            _real_height = origin.height / _patch_size;
 
             // The resulted frame dimension will be dividible by 4;
             _padded_width = _real_width + 3;
@@ -329,13 +369,15 @@ namespace librealsense
             tgt_intrin.height = _padded_height;
             tgt_intrin.fx = src_intrin.fx / _patch_size;
             tgt_intrin.fy = src_intrin.fy / _patch_size;
-            tgt_intrin.ppx = src_intrin.ppx / _patch_size;
-            tgt_intrin.ppy = src_intrin.ppy / _patch_size;
+            tgt_intrin.ppx = (src_intrin.ppx - origin.x) / _patch_size;
+            tgt_intrin.ppy = (src_intrin.ppy - origin.y) / _patch_size;
 
             tgt_vspi->set_intrinsics([tgt_intrin]() { return tgt_intrin; });
             tgt_vspi->set_dims(tgt_intrin.width, tgt_intrin.height);
 
-            _registered_profiles[std::make_tuple(_source_stream_profile.get(), _decimation_factor)] = _target_stream_profile = tmp_profile;
+            _target_stream_profile = tmp_profile;
+            if (!_roi.crop())
+                _registered_profiles[std::make_tuple(_source_stream_profile.get(), _decimation_factor)] = tmp_profile;
 
             _recalc_profile = false;
         }
@@ -6,6 +6,7 @@
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
+#include "proc/processing-roi.h"
 
 namespace librealsense
 {
@@ -26,6 +27,8 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
+        friend class depth_post_processing;
+
         void    update_output_profile(const rs2::frame& f);
 
         uint8_t                 _decimation_factor;
@@ -41,6 +44,9 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        processing_roi          _roi;
+        pixel_rect              _roi_rect;          // Region of interest of the input frame, made of whole patches
+        std::vector<uint8_t>    _roi_buffer;        // Decimated region of interest of an uncropped output
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
@@ -0,0 +1,142 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "proc/deprojection-map-cache.h"
+#include "concurrency.h"
+
+#include <algorithm>
+
+namespace librealsense
+{
+    deprojection_map_cache& deprojection_map_cache::get_instance()
+    {
+        static deprojection_map_cache cache;
+        return cache;
+    }
+
+    deprojection_map deprojection_map_cache::build(const rs2_intrinsics& intrinsics, float offset)
+    {
+        deprojection_map map;
+        map.x.resize(intrinsics.width*intrinsics.height);
+        map.y.resize(intrinsics.width*intrinsics.height);
+
+        thread_pool::get_default().parallel_for(0, intrinsics.height, [&](int begin, int end)
+        {
+            for (int h = begin; h < end; ++h)
+            {
+                for (int w = 0; w < intrinsics.width; ++w)
+                {
+                    const float pixel[] = { (float)w + offset, (float)h + offset };
+
+                    float x = (pixel[0] - intrinsics.ppx) / intrinsics.fx;
+                    float y = (pixel[1] - intrinsics.ppy) / intrinsics.fy;
+
+                    if (intrinsics.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
+                    {
+                        float r2 = x * x + y * y;
+                        float f = 1 + intrinsics.coeffs[0] * r2 + intrinsics.coeffs[1] * r2*r2 + intrinsics.coeffs[4] * r2*r2*r2;
+                        float ux = x * f + 2 * intrinsics.coeffs[2] * x*y + intrinsics.coeffs[3] * (r2 + 2 * x*x);
+                        float uy = y * f + 2 * intrinsics.coeffs[3] * x*y + intrinsics.coeffs[2] * (r2 + 2 * y*y);
+                        x = ux;
+                        y = uy;
+                    }
+
+                    map.x[h*intrinsics.width + w] = x;
+                    map.y[h*intrinsics.width + w] = y;
+                }
+            }
+        }, 16);
+
+        return map;
+    }
+
+    bool deprojection_map_cache::matches(const entry& e, const rs2_intrinsics& intrinsics, float offset)
+    {
+        auto& a = e.intrinsics;
+        auto& b = intrinsics;
+        return e.offset == offset &&
+            a.width == b.width && a.height == b.height &&
+            a.ppx == b.ppx && a.ppy == b.ppy && a.fx == b.fx && a.fy == b.fy &&
+            a.model == b.model && std::equal(a.coeffs, a.coeffs + 5, b.coeffs);
+    }
+
+    std::shared_ptr<const deprojection_map> deprojection_map_cache::get(const rs2_intrinsics& intrinsics, float offset)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = std::find_if(_entries.begin(), _entries.end(), [&](const entry& e) { return matches(e, intrinsics, offset); });
+            if (it != _entries.end())
+            {
+                ++_hits;
+                _entries.splice(_entries.begin(), _entries, it);
+                return it->map;
+            }
+        }
+
+        // Build outside of the lock, lookups of other maps are not held back meanwhile
+        auto map = std::make_shared<const deprojection_map>(build(intrinsics, offset));
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Another block may have built the same map in the meantime, keep the first one
+        auto it = std::find_if(_entries.begin(), _entries.end(), [&](const entry& e) { return matches(e, intrinsics, offset); });
+        if (it != _entries.end())
+        {
+            ++_hits;
+            _entries.splice(_entries.begin(), _entries, it);
+            return it->map;
+        }
+
+        ++_misses;
+        _entries.push_front({ intrinsics, offset, map });
+        evict();
+        return map;
+    }
+
+    // Drop the least recently used maps no block references anymore, beyond capacity of those
+    void deprojection_map_cache::evict()
+    {
+        size_t unused = 0;
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            if (it->map.use_count() > 1)
+            {
+                ++it;
+                continue;
+            }
+
+            if (++unused > _capacity)
+            {
+                it = _entries.erase(it);
+                ++_evictions;
+            }
+            else
+                ++it;
+        }
+    }
+
+    void deprojection_map_cache::set_capacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _capacity = capacity;
+        evict();
+    }
+
+    deprojection_map_cache_stats deprojection_map_cache::get_stats() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        deprojection_map_cache_stats stats{ _entries.size(), 0, 0, _hits, _misses, _evictions };
+        for (auto&& e : _entries)
+        {
+            if (e.map.use_count() > 1) ++stats.in_use;
+            stats.bytes += (e.map->x.capacity() + e.map->y.capacity()) * sizeof(float);
+        }
+        return stats;
+    }
+
+    void deprojection_map_cache::clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _evictions += _entries.size();
+        _entries.clear();
+    }
+}
@@ -0,0 +1,74 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../include/librealsense2/h/rs_types.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace librealsense
+{
+    // Per-pixel normalized ray (x, y) of a depth stream, with the depth distortion already undone:
+    // point = depth * (x[i], y[i], 1). offset shifts the sampled position inside the pixel (-0.5 and 0.5
+    // give the pixel corners used by align)
+    struct deprojection_map
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+    };
+
+    struct deprojection_map_cache_stats
+    {
+        size_t entries;     // Maps currently held by the cache
+        size_t in_use;      // Of these, maps still referenced by a processing block
+        size_t bytes;       // Memory held by all the cached maps
+        size_t hits;
+        size_t misses;      // Lookups that had to build a map
+        size_t evictions;
+    };
+
+    // Process-wide cache of deprojection maps, shared by pointcloud_sse and align_sse so that blocks
+    // working on the same depth stream do not each hold and rebuild their own tables.
+    // Maps are built lazily on the first lookup and handed out as shared pointers. Once no block
+    // references a map anymore it stays cached; when a new map is added, the least recently used
+    // unreferenced maps beyond capacity are evicted
+    class deprojection_map_cache
+    {
+    public:
+        explicit deprojection_map_cache(size_t capacity = DEFAULT_CAPACITY) : _capacity(capacity) {}
+
+        static deprojection_map_cache& get_instance();
+
+        std::shared_ptr<const deprojection_map> get(const rs2_intrinsics& intrinsics, float offset = 0.f);
+
+        void set_capacity(size_t capacity);
+        deprojection_map_cache_stats get_stats() const;
+        void clear();
+
+        static deprojection_map build(const rs2_intrinsics& intrinsics, float offset);
+
+        static const size_t DEFAULT_CAPACITY = 4;
+
+    private:
+        struct entry
+        {
+            rs2_intrinsics intrinsics;
+            float offset;
+            std::shared_ptr<const deprojection_map> map;
+        };
+
+        static bool matches(const entry& e, const rs2_intrinsics& intrinsics, float offset);
+        void evict();
+
+        mutable std::mutex _mutex;
+        std::list<entry> _entries; // Most recently used first
+        size_t _capacity;
+        size_t _hits = 0;
+        size_t _misses = 0;
+        size_t _evictions = 0;
+    };
+}
@@ -0,0 +1,260 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "../include/librealsense2/hpp/rs_sensor.hpp"
+#include "../include/librealsense2/hpp/rs_processing.hpp"
+
+#include "option.h"
+#include "environment.h"
+#include "context.h"
+#include "proc/synthetic-stream.h"
+#include "proc/decimation-filter.h"
+#include "proc/disparity-transform.h"
+#include "proc/spatial-filter.h"
+#include "proc/temporal-filter.h"
+#include "proc/hole-filling-filter.h"
+#include "proc/depth-post-processing.h"
+
+namespace librealsense
+{
+    depth_post_processing::depth_post_processing(const std::vector<std::shared_ptr<processing_block>>& stages)
+        : stream_filter_processing_block("Depth Post-Processing"),
+        _output_type(RS2_EXTENSION_DEPTH_FRAME),
+        _output_data(nullptr)
+    {
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+        _stream_filter.format = RS2_FORMAT_Z16;
+
+        if (stages.empty())
+            throw invalid_value_exception("Depth post-processing requires at least one filter");
+
+        int last_stage = -1;
+        for (auto&& block : stages)
+        {
+            int stage;
+            if (auto decimation = std::dynamic_pointer_cast<decimation_filter>(block))
+            {
+                _decimation = decimation;
+                stage = 0;
+            }
+            else if (auto disparity = std::dynamic_pointer_cast<disparity_transform>(block))
+            {
+                if (disparity->_transform_to_disparity)
+                {
+                    _depth_to_disparity = disparity;
+                    stage = 1;
+                }
+                else
+                {
+                    _disparity_to_depth = disparity;
+                    stage = 4;
+                }
+            }
+            else if (auto spatial = std::dynamic_pointer_cast<spatial_filter>(block))
+            {
+                _spatial = spatial;
+                stage = 2;
+            }
+            else if (auto temporal = std::dynamic_pointer_cast<temporal_filter>(block))
+            {
+                _temporal = temporal;
+                stage = 3;
+            }
+            else if (auto hole_filling = std::dynamic_pointer_cast<hole_filling_filter>(block))
+            {
+                _hole_filling = hole_filling;
+                stage = 5;
+            }
+            else
+                throw invalid_value_exception(to_string() << "Depth post-processing does not support "
+                    << (block ? block->get_info(RS2_CAMERA_INFO_NAME) : "a null block"));
+
+            if (stage <= last_stage)
+                throw invalid_value_exception(to_string() << "Depth post-processing filters must follow the decimation, depth to disparity, "
+                    "spatial, temporal, disparity to depth and hole filling order, " << block->get_info(RS2_CAMERA_INFO_NAME) << " is out of order");
+            last_stage = stage;
+        }
+
+        unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
+    }
+
+    void* depth_post_processing::get_buffer(rs2_extension type, size_t pixels)
+    {
+        // Stages producing the output type write straight to the output frame
+        if (type == _output_type)
+            return _output_data;
+
+        if (type == RS2_EXTENSION_DISPARITY_FRAME)
+        {
+            _disparity_buffer.resize(pixels);
+            return _disparity_buffer.data();
+        }
+        _depth_buffer.resize(pixels);
+        return _depth_buffer.data();
+    }
+
+    rs2::frame depth_post_processing::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        // The stages are held for the whole frame, so that their options change between frames only
+        std::vector<std::unique_lock<std::mutex>> locks;
+        if (_decimation) locks.emplace_back(_decimation->_mutex);
+        if (_depth_to_disparity) locks.emplace_back(_depth_to_disparity->_mutex);
+        if (_spatial) locks.emplace_back(_spatial->_mutex);
+        if (_temporal) locks.emplace_back(_temporal->_mutex);
+        if (_disparity_to_depth) locks.emplace_back(_disparity_to_depth->_mutex);
+        if (_hole_filling) locks.emplace_back(_hole_filling->_mutex);
+
+        // Stages restricted to a region of interest change the frame layout between stages, the chain runs as is
+        if ((_decimation && _decimation->_roi.is_set()) || (_spatial && _spatial->_roi.is_set()) ||
+            (_temporal && _temporal->_roi.is_set()) || (_hole_filling && _hole_filling->_roi.is_set()))
+        {
+            rs2::frame out = f;
+            if (_decimation && _decimation->should_process(out)) out = _decimation->process_frame(source, out);
+            if (_depth_to_disparity && _depth_to_disparity->should_process(out)) out = _depth_to_disparity->process_frame(source, out);
+            if (_spatial && _spatial->should_process(out)) out = _spatial->process_frame(source, out);
+            if (_temporal && _temporal->should_process(out)) out = _temporal->process_frame(source, out);
+            if (_disparity_to_depth && _disparity_to_depth->should_process(out)) out = _disparity_to_depth->process_frame(source, out);
+            if (_hole_filling && _hole_filling->should_process(out)) out = _hole_filling->process_frame(source, out);
+            return out;
+        }
+
+        // Resolve the profile every stage sees, as a chain of the filters would, before touching the data
+        rs2::stream_profile profile = f.get_profile();
+        rs2_extension type = RS2_EXTENSION_DEPTH_FRAME;
+
+        if (_decimation)
+        {
+            _decimation->update_output_profile(f);
+            profile = _decimation->_target_stream_profile;
+        }
+
+        // The disparity transformation applies to stereoscopic depth only, it is skipped otherwise
+        bool to_disparity = false;
+        if (_depth_to_disparity)
+        {
+            _depth_to_disparity->update_transformation_profile(f, profile);
+            if ((to_disparity = _depth_to_disparity->_stereoscopic_depth))
+            {
+                profile = _depth_to_disparity->_target_stream_profile;
+                type = RS2_EXTENSION_DISPARITY_FRAME;
+            }
+        }
+
+        if (_spatial)
+        {
+            _spatial->update_configuration(f, profile, type);
+            profile = _spatial->_target_stream_profile;
+        }
+
+        if (_temporal)
+        {
+            _temporal->update_configuration(profile, type);
+            profile = _temporal->_target_stream_profile;
+        }
+
+        bool to_depth = false;
+        if (_disparity_to_depth && type == RS2_EXTENSION_DISPARITY_FRAME)
+        {
+            _disparity_to_depth->update_transformation_profile(f, profile);
+            if ((to_depth = _disparity_to_depth->_stereoscopic_depth))
+            {
+                profile = _disparity_to_depth->_target_stream_profile;
+                type = RS2_EXTENSION_DEPTH_FRAME;
+            }
+        }
+
+        if (_hole_filling)
+        {
+            _hole_filling->update_configuration(profile, type);
+            profile = _hole_filling->_target_stream_profile;
+        }
+
+        // The single frame allocation of the chain
+        auto vp = profile.as<rs2::video_stream_profile>();
+        size_t width = vp.width();
+        size_t height = vp.height();
+        size_t pixels = width * height;
+        int bpp = (type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
+
+        auto tgt = source.allocate_video_frame(profile, f, bpp, int(width), int(height), int(width * bpp), type);
+        if (!tgt)
+            return f;
+
+        _output_type = type;
+        _output_data = const_cast<void*>(tgt.get_data());
+
+        // Run the stages, data points to the current stage input and is writable once a stage produced it
+        auto vf = f.as<rs2::video_frame>();
+        const void* data = vf.get_data();
+        void* writable = nullptr;
+        type = RS2_EXTENSION_DEPTH_FRAME;
+
+        // The in-place filters start from a copy of the input frame when nothing has been written yet
+        auto make_writable = [&]()
+        {
+            if (!writable)
+            {
+                auto bytes = pixels * ((type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t));
+                writable = get_buffer(type, pixels);
+                memmove(writable, data, bytes);
+                data = writable;
+            }
+            return writable;
+        };
+
+        if (_decimation)
+        {
+            writable = get_buffer(RS2_EXTENSION_DEPTH_FRAME, pixels);
+            _decimation->decimate_depth(static_cast<const uint16_t*>(data), static_cast<uint16_t*>(writable),
+                vf.get_width(), vf.get_height(), _decimation->_patch_size);
+            data = writable;
+        }
+
+        if (to_disparity)
+        {
+            writable = get_buffer(RS2_EXTENSION_DISPARITY_FRAME, pixels);
+            _depth_to_disparity->convert<uint16_t, float>(data, writable);
+            data = writable;
+            type = RS2_EXTENSION_DISPARITY_FRAME;
+        }
+
+        if (_spatial)
+        {
+            if (type == RS2_EXTENSION_DISPARITY_FRAME)
+                _spatial->dxf_smooth<float>(make_writable(), _spatial->_spatial_alpha_param, _spatial->_spatial_edge_threshold, _spatial->_spatial_iterations);
+            else
+                _spatial->dxf_smooth<uint16_t>(make_writable(), _spatial->_spatial_alpha_param, _spatial->_spatial_edge_threshold, _spatial->_spatial_iterations);
+        }
+
+        if (_temporal)
+        {
+            if (type == RS2_EXTENSION_DISPARITY_FRAME)
+                _temporal->temp_jw_smooth<float>(make_writable(), _temporal->_last_frame.data(), _temporal->_history.data());
+            else
+                _temporal->temp_jw_smooth<uint16_t>(make_writable(), _temporal->_last_frame.data(), _temporal->_history.data());
+        }
+
+        if (to_depth)
+        {
+            writable = get_buffer(RS2_EXTENSION_DEPTH_FRAME, pixels);
+            _disparity_to_depth->convert<float, uint16_t>(data, writable);
+            data = writable;
+            type = RS2_EXTENSION_DEPTH_FRAME;
+        }
+
+        if (_hole_filling)
+        {
+            if (type == RS2_EXTENSION_DISPARITY_FRAME)
+                _hole_filling->apply_hole_filling<float>(make_writable());
+            else
+                _hole_filling->apply_hole_filling<uint16_t>(make_writable());
+        }
+
+        // Every stage writes its output type to the output frame, unless none of them ran
+        if (data != _output_data)
+            memmove(_output_data, data, pixels * bpp);
+
+        _output_data = nullptr;
+        return tgt;
+    }
+}
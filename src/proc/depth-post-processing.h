@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+// Runs a chain of depth post-processing filters as a single processing block
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+namespace librealsense
+{
+    class decimation_filter;
+    class disparity_transform;
+    class spatial_filter;
+    class temporal_filter;
+    class hole_filling_filter;
+
+    // Applies the recommended depth post-processing sequence: decimation, depth to disparity, spatial, temporal,
+    // disparity to depth and hole filling, each of them optional. The stages are the caller's filter instances,
+    // configured through their own options, and are given in that order.
+    // The filters run back to back on the output frame and a pair of internal buffers reused between frames,
+    // producing the same data as chaining them without the intermediate frame allocations and copies.
+    // When a stage is restricted to a region of interest the filters run as a plain chain
+    class depth_post_processing : public stream_filter_processing_block
+    {
+    public:
+        depth_post_processing(const std::vector<std::shared_ptr<processing_block>>& stages);
+
+    protected:
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        void* get_buffer(rs2_extension type, size_t pixels);
+
+        std::shared_ptr<decimation_filter>      _decimation;
+        std::shared_ptr<disparity_transform>    _depth_to_disparity;
+        std::shared_ptr<spatial_filter>         _spatial;
+        std::shared_ptr<temporal_filter>        _temporal;
+        std::shared_ptr<disparity_transform>    _disparity_to_depth;
+        std::shared_ptr<hole_filling_filter>    _hole_filling;
+
+        rs2_extension                           _output_type;
+        void*                                   _output_data;
+        std::vector<uint16_t>                   _depth_buffer;      // Depth data of a disparity domain output
+        std::vector<float>                      _disparity_buffer;  // Disparity data of a depth domain output
+    };
+}
@@ -90,11 +90,16 @@ namespace librealsense
 
     void disparity_transform::update_transformation_profile(const rs2::frame& f)
     {
-        if(f.get_profile().get() != _source_stream_profile.get())
+        update_transformation_profile(f, f.get_profile());
+    }
+
+    void disparity_transform::update_transformation_profile(const rs2::frame& f, const rs2::stream_profile& profile)
+    {
+        if(profile.get() != _source_stream_profile.get())
         {
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
 
-            auto info = disparity_info::update_info_from_frame(f);
+            auto info = disparity_info::update_info_from_frame(f, profile);
             _stereoscopic_depth = info.stereoscopic_depth;
             _depth_units = info.depth_units;
             _d2d_convert_factor = info.d2d_convert_factor;
@@ -3,6 +3,8 @@
 // Enhancing the input video frame by filling missing data.
 #pragma once
 
+#include "proc/processing-roi.h"
+
 namespace librealsense
 {
     enum holes_filling_types : uint8_t
@@ -20,6 +22,7 @@ namespace librealsense
 
     protected:
         void update_configuration(const rs2::frame& f);
+        void update_configuration(const rs2::stream_profile& profile, rs2_extension type);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
@@ -157,14 +160,18 @@ namespace librealsense
         }
 
     private:
+        friend class depth_post_processing;
 
-        size_t                  _width, _height, _stride;
+        size_t                  _width, _height, _stride;   // Size of the region filled, stride of the target frame
+        size_t                  _target_width, _target_height;
         size_t                  _bpp;
         rs2_extension           _extension_type;            // Strictly Depth/Disparity
         size_t                  _current_frm_size_pixels;
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         uint8_t                 _hole_filling_mode;
+        processing_roi          _roi;
+        pixel_rect              _roi_rect;                  // Region of interest of the input frame
     };
     MAP_EXTENSION(RS2_EXTENSION_HOLE_FILLING_FILTER, librealsense::hole_filling_filter);
 }
@@ -53,32 +53,51 @@ namespace librealsense
 
     rs2::frame motion_transform::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
-        auto&& ret = functional_processing_block::process_frame(source, f);
-        correct_motion(&ret);
+        auto mf = dynamic_cast<librealsense::motion_frame*>((frame_interface*)f.get());
+        auto samples = mf ? mf->get_samples_count() : 0;
+        if (!samples)
+        {
+            auto&& ret = functional_processing_block::process_frame(source, f);
+            correct_motion((float3*)ret.get_data(), sizeof(float3), 1, f.get_profile().stream_type());
+
+            return ret;
+        }
+
+        // A batched frame is converted sample by sample, then corrected over the whole batch
+        auto&& ret = prepare_frame(source, f);
+        auto src = reinterpret_cast<const rs2_motion_sample*>(f.get_data());
+        auto dst = reinterpret_cast<rs2_motion_sample*>(const_cast<void*>(ret.get_data()));
+        for (uint32_t i = 0; i < samples; ++i)
+        {
+            byte* planes[1] = { reinterpret_cast<byte*>(&dst[i].value) };
+            process_function(planes, reinterpret_cast<const byte*>(&src[i].value), 0, 0, 0);
+            dst[i].timestamp = src[i].timestamp;
+        }
+        correct_motion(reinterpret_cast<float3*>(&dst[0].value), sizeof(rs2_motion_sample), samples, f.get_profile().stream_type());
 
         return ret;
     }
 
-    void motion_transform::correct_motion(rs2::frame* f)
+    void motion_transform::correct_motion(float3* xyz, size_t stride, size_t count, rs2_stream s)
     {
         if (!_mm_calib)
             return;
 
-        auto xyz = (float3*)(f->get_data());
+        auto at = [xyz, stride](size_t i) -> float3& { return *reinterpret_cast<float3*>(reinterpret_cast<byte*>(xyz) + i * stride); };
 
+        // The calibration is resolved once per frame, whatever the number of samples
         try
         {
             auto accel_intrinsic = _mm_calib->get_intrinsic(RS2_STREAM_ACCEL);
             auto gyro_intrinsic = _mm_calib->get_intrinsic(RS2_STREAM_GYRO);
 
-            if (_is_motion_correction_enabled)
+            if (_is_motion_correction_enabled && (s == RS2_STREAM_ACCEL || s == RS2_STREAM_GYRO))
             {
-                auto&& s = f->get_profile().stream_type();
-                if (s == RS2_STREAM_ACCEL)
-                    *xyz = (accel_intrinsic.sensitivity * (*xyz)) - accel_intrinsic.bias;
-
-                if (s == RS2_STREAM_GYRO)
-                    *xyz = gyro_intrinsic.sensitivity * (*xyz) - gyro_intrinsic.bias;
+                auto&& intrinsic = (s == RS2_STREAM_ACCEL) ? accel_intrinsic : gyro_intrinsic;
+                auto sensitivity = intrinsic.sensitivity;
+                auto bias = intrinsic.bias;
+                for (size_t i = 0; i < count; ++i)
+                    at(i) = sensitivity * at(i) - bias;
             }
         }
         catch (const std::exception& ex)
@@ -87,7 +106,9 @@ namespace librealsense
         }
 
         // The IMU sensor orientation shall be aligned with depth sensor's coordinate system
-        *xyz = _mm_calib->imu_to_depth_alignment() * (*xyz);
+        auto alignment = _mm_calib->imu_to_depth_alignment();
+        for (size_t i = 0; i < count; ++i)
+            at(i) = alignment * at(i);
     }
 
     acceleration_transform::acceleration_transform(std::shared_ptr<mm_calib_handler> mm_calib, bool is_motion_correction_enabled)
@@ -19,7 +19,8 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
-        void correct_motion(rs2::frame* f);
+        // Corrects count vectors stride bytes apart, of the stream s
+        void correct_motion(float3* xyz, size_t stride, size_t count, rs2_stream s);
 
         std::shared_ptr<mm_calib_handler> _mm_calib = nullptr;
         bool _is_motion_correction_enabled = false;
@@ -6,17 +6,19 @@
 
 #include "proc/synthetic-stream.h"
 #include "proc/occlusion-filter.h"
+#include "concurrency.h"
+
+#include <cstring>
 
 namespace librealsense
 {
-    occlusion_filter::occlusion_filter() : _occlusion_filter(occlusion_none)
+    occlusion_filter::occlusion_filter() : _occlusion_filter(occlusion_none), _texel_decimation(1)
     {
     }
 
     void occlusion_filter::set_texel_intrinsics(const rs2_intrinsics& in)
     {
         _texels_intrinsics = in;
-        _texels_depth.resize(_texels_intrinsics.value().width*_texels_intrinsics.value().height);
     }
 
     void occlusion_filter::process(float3* points, float2* uv_map, const std::vector<float2> & pix_coord) const
@@ -49,44 +51,76 @@ namespace librealsense
     {
         float occZTh = 0.1f; //meters
         int occDilationSz = 1;
-        auto pixels_ptr = pix_coord.data();
         auto points_width = _depth_intrinsics->width;
         auto points_height = _depth_intrinsics->height;
 
-        for (size_t y = 0; y < points_height; ++y)
+        // Lines are scanned independently of each other
+        thread_pool::get_default().parallel_for(0, points_height, [&](int begin, int end)
         {
-            float maxInLine = -1;
-            float maxZ = 0;
-            int occDilationLeft = 0;
-
-            for (size_t x = 0; x < points_width; ++x)
+            for (int y = begin; y < end; ++y)
             {
-                if (points->z)
+                auto line_points = points + y * points_width;
+                auto line_uv = uv_map + y * points_width;
+                auto pixels_ptr = pix_coord.data() + y * points_width;
+
+                float maxInLine = -1;
+                float maxZ = 0;
+                int occDilationLeft = 0;
+
+                for (int x = 0; x < points_width; ++x)
                 {
-                    // Occlusion detection
-                    if (pixels_ptr->x < maxInLine || (pixels_ptr->x == maxInLine && (points->z - maxZ) > occZTh))
-                    {
-                        uv_map->x = 0.f;
-                        uv_map->y = 0.f;
-                        occDilationLeft = occDilationSz;
-                    }
-                    else
+                    if (line_points->z)
                     {
-                        maxInLine = pixels_ptr->x;
-                        maxZ = points->z;
-                        if (occDilationLeft > 0)
+                        // Occlusion detection
+                        if (pixels_ptr->x < maxInLine || (pixels_ptr->x == maxInLine && (line_points->z - maxZ) > occZTh))
                         {
-                            uv_map->x = 0.f;
-                            uv_map->y = 0.f;
-                            occDilationLeft--;
+                            line_uv->x = 0.f;
+                            line_uv->y = 0.f;
+                            occDilationLeft = occDilationSz;
+                        }
+                        else
+                        {
+                            maxInLine = pixels_ptr->x;
+                            maxZ = line_points->z;
+                            if (occDilationLeft > 0)
+                            {
+                                line_uv->x = 0.f;
+                                line_uv->y = 0.f;
+                                occDilationLeft--;
+                            }
                         }
                     }
-                }
 
-                ++points;
-                ++uv_map;
-                ++pixels_ptr;
+                    ++line_points;
+                    ++line_uv;
+                    ++pixels_ptr;
+                }
             }
+        }, 16);
+    }
+
+    namespace
+    {
+        const uint32_t no_depth = 0xffffffff; // Empty texel cell, above the bits of any depth
+
+        inline uint32_t depth_bits(float z)
+        {
+            uint32_t bits;
+            memcpy(&bits, &z, sizeof(bits));
+            return bits;
+        }
+
+        inline float bits_depth(uint32_t bits)
+        {
+            float z;
+            memcpy(&z, &bits, sizeof(z));
+            return z;
+        }
+
+        inline void atomic_min(std::atomic<uint32_t>& cell, uint32_t value)
+        {
+            auto current = cell.load(std::memory_order_relaxed);
+            while (value < current && !cell.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
         }
     }
 
@@ -96,69 +130,90 @@ namespace librealsense
     // Vector of 3D [xyz] coordinates of depth_width*depth_height size
     // Vector of 2D [i,j] coordinates where the val[i,j] stores the texture coordinate (s,t) for the corresponding (i,j) pixel in depth frame
     // Algo intermediate data:
-    // Vector of depth values (floats) in size of the mapped texture (different from depth width*height) where
-    // each (i,j) cell holds the minimal Z among all the depth pixels that are mapped to the specific texel
+    // Vector of depth values in size of the mapped texture, divided by the texel decimation (different from depth width*height) where
+    // each (i,j) cell holds the minimal Z among all the depth pixels that are mapped to the specific texel cell
+    // Both passes run on bands of depth lines in parallel, the minimal Z is kept with an atomic min so that the result
+    // does not depend on the order the bands are processed in
     void occlusion_filter::comprehensive_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord) const
     {
-        auto depth_points = points;
-        auto mapped_pix = pix_coord.data();
         size_t mapped_tex_width = _texels_intrinsics->width;
         size_t mapped_tex_height = _texels_intrinsics->height;
-        size_t points_width = _depth_intrinsics->width;
-        size_t points_height = _depth_intrinsics->height;
+        int points_width = _depth_intrinsics->width;
+        int points_height = _depth_intrinsics->height;
+
+        size_t decimation = std::max<size_t>(1, _texel_decimation);
+        size_t cells_width = (mapped_tex_width + decimation - 1) / decimation;
+        size_t cells_height = (mapped_tex_height + decimation - 1) / decimation;
+        if (_texels_depth.size() != cells_width * cells_height)
+            _texels_depth = std::vector<std::atomic<uint32_t>>(cells_width * cells_height);
+
+        // Texel column / row to cell offset, saves the divisions by the decimation per pixel
+        _cell_columns.resize(mapped_tex_width);
+        for (size_t x = 0; x < mapped_tex_width; ++x)
+            _cell_columns[x] = x / decimation;
+        _cell_rows.resize(mapped_tex_height);
+        for (size_t y = 0; y < mapped_tex_height; ++y)
+            _cell_rows[y] = (y / decimation) * cells_width;
 
         static const float z_threshold = 0.05f; // Compensate for temporal noise when comparing Z values
 
-        // Clear previous data
-        memset((void*)(_texels_depth.data()), 0, _texels_depth.size() * sizeof(float));
-
-        // Pass1 -generate texels mapping with minimal depth for each texel involved
-        for (size_t i = 0; i < points_height; i++)
+        auto texels_depth = _texels_depth.data();
+        auto cell_rows = _cell_rows.data();
+        auto cell_columns = _cell_columns.data();
+        auto tex_width = static_cast<float>(mapped_tex_width);
+        auto tex_height = static_cast<float>(mapped_tex_height);
+        auto cell_index = [=](const float3& point, const float2& pix, size_t& index)
         {
-            for (size_t j = 0; j < points_width; j++)
+            if ((point.z > 0.0001f) &&
+                (pix.x > 0.f) && (pix.x < tex_width) &&
+                (pix.y > 0.f) && (pix.y < tex_height))
             {
-                if ((depth_points->z > 0.0001f) &&
-                    (mapped_pix->x > 0.f) && (mapped_pix->x < mapped_tex_width) &&
-                    (mapped_pix->y > 0.f) && (mapped_pix->y < mapped_tex_height))
-                {
-                    size_t texel_index = (size_t)(mapped_pix->y)*mapped_tex_width + (size_t)(mapped_pix->x);
+                index = cell_rows[(size_t)(pix.y)] + cell_columns[(size_t)(pix.x)];
+                return true;
+            }
+            return false;
+        };
 
-                    if ((_texels_depth[texel_index] < 0.0001f) || ((_texels_depth[texel_index] + z_threshold) > depth_points->z))
-                    {
-                        _texels_depth[texel_index] = depth_points->z;
-                    }
-                }
+        auto& pool = thread_pool::get_default();
 
-                ++depth_points;
-                ++mapped_pix;
-            }
-        }
+        // Clear previous data
+        pool.parallel_for(0, static_cast<int>(cells_height), [&](int begin, int end)
+        {
+            for (size_t i = begin * cells_width; i < end * cells_width; ++i)
+                texels_depth[i].store(no_depth, std::memory_order_relaxed);
+        }, 16);
+
+        auto mapped_pixels = pix_coord.data();
 
-        mapped_pix = pix_coord.data();
-        depth_points = points;
-        auto uv_ptr = uv_map;
+        // Pass1 -generate texels mapping with minimal depth for each texel cell involved
+        pool.parallel_for(0, points_height, [=](int begin, int end)
+        {
+            auto depth_points = points + begin * points_width;
+            auto mapped_pix = mapped_pixels + begin * points_width;
+            for (auto last = points + end * points_width; depth_points < last; ++depth_points, ++mapped_pix)
+            {
+                size_t index;
+                if (cell_index(*depth_points, *mapped_pix, index))
+                    atomic_min(texels_depth[index], depth_bits(depth_points->z));
+            }
+        }, 16);
 
         // Pass2 -invalidate depth texels with occlusion traits
-        for (size_t i = 0; i < points_height; i++)
+        pool.parallel_for(0, points_height, [=](int begin, int end)
         {
-            for (size_t j = 0; j < points_width; j++)
+            auto depth_points = points + begin * points_width;
+            auto mapped_pix = mapped_pixels + begin * points_width;
+            auto uv_ptr = uv_map + begin * points_width;
+            for (auto last = points + end * points_width; depth_points < last; ++depth_points, ++mapped_pix, ++uv_ptr)
             {
-                if ((depth_points->z > 0.0001f) &&
-                    (mapped_pix->x > 0.f) && (mapped_pix->x < mapped_tex_width) &&
-                    (mapped_pix->y > 0.f) && (mapped_pix->y < mapped_tex_height))
+                size_t index;
+                if (cell_index(*depth_points, *mapped_pix, index))
                 {
-                    size_t texel_index = (size_t)(mapped_pix->y)*mapped_tex_width + (size_t)(mapped_pix->x);
-
-                    if ((_texels_depth[texel_index] > 0.0001f) && ((_texels_depth[texel_index] + z_threshold) < depth_points->z))
-                    {
+                    auto min_z = bits_depth(texels_depth[index].load(std::memory_order_relaxed));
+                    if ((min_z + z_threshold) < depth_points->z)
                         *uv_ptr = { 0.f, 0.f };
-                    }
                 }
-
-                ++depth_points;
-                ++mapped_pix;
-                ++uv_ptr;
             }
-        }
+        }, 16);
     }
 }
@@ -3,6 +3,9 @@
 
 #pragma once
 #include "../include/librealsense2/hpp/rs_frame.hpp"
+
+#include <atomic>
+
 namespace librealsense
 {
     enum occlusion_rect_type : uint8_t {
@@ -26,6 +29,10 @@ namespace librealsense
 
         void set_texel_intrinsics(const rs2_intrinsics& in);
         void set_depth_intrinsics(const rs2_intrinsics& in) { _depth_intrinsics = in; }
+
+        // Resolve occlusions on a grid of (decimation x decimation) texel cells instead of single texels
+        void set_texel_decimation(uint8_t decimation) { _texel_decimation = decimation; }
+        uint8_t get_texel_decimation() const { return _texel_decimation; }
     private:
 
         friend class pointcloud;
@@ -36,7 +43,12 @@ namespace librealsense
 
         optional_value<rs2_intrinsics>              _depth_intrinsics;
         optional_value<rs2_intrinsics>              _texels_intrinsics;
-        mutable std::vector<float>                  _texels_depth; // Temporal translation table of (mapped_x*mapped_y) holds the minimal depth value among all depth pixels mapped to that texel
+        // Temporal translation table of the texel cells, holds the minimal depth among all depth pixels mapped to each cell.
+        // Depths are positive, so their bit patterns order like the values and a cell is updated with an integer atomic min
+        mutable std::vector<std::atomic<uint32_t>>  _texels_depth;
+        mutable std::vector<size_t>                 _cell_columns;
+        mutable std::vector<size_t>                 _cell_rows;
         occlusion_rect_type                         _occlusion_filter;
+        uint8_t                                     _texel_decimation;
     };
 }
@@ -19,6 +19,7 @@
 #endif
 #ifdef __SSSE3__
 #include "proc/sse/sse-pointcloud.h"
+#include <tmmintrin.h> // For SSSE3 intrinsics
 #endif
 
 
@@ -50,6 +51,109 @@ namespace librealsense
     float2 pixel_to_texcoord(const rs2_intrinsics *intrin, const float2 & pixel) { return{ pixel.x / (intrin->width), pixel.y / (intrin->height) }; }
     float2 project_to_texcoord(const rs2_intrinsics *intrin, const float3 & point) { return pixel_to_texcoord(intrin, project(intrin, point)); }
 
+#ifdef __SSSE3__
+    // For every 8-bit mask of valid lanes, the positions of the set bits packed to the front
+    struct compaction_table
+    {
+        uint8_t lanes[256][8];
+        uint8_t count[256];
+
+        compaction_table()
+        {
+            memset(lanes, 0, sizeof(lanes));
+            for (int mask = 0; mask < 256; ++mask)
+            {
+                int n = 0;
+                for (int lane = 0; lane < 8; ++lane)
+                    if (mask & (1 << lane)) lanes[mask][n++] = lane;
+                count[mask] = n;
+            }
+        }
+    };
+#endif
+
+    size_t find_valid_pixels(const uint16_t* depth, size_t size, std::vector<int>& valid)
+    {
+        valid.resize(size + 8); // Room for the full stores of the last block
+        auto out = valid.data();
+        size_t count = 0;
+        size_t i = 0;
+#ifdef __SSSE3__
+        static const compaction_table table;
+        auto zero = _mm_setzero_si128();
+        for (; i + 8 <= size; i += 8)
+        {
+            auto d = _mm_loadu_si128((const __m128i*)(depth + i));
+            auto invalid = _mm_packs_epi16(_mm_cmpeq_epi16(d, zero), zero);
+            auto mask = ~_mm_movemask_epi8(invalid) & 0xff;
+
+            // Widen the packed lane numbers to 32 bit and offset them by the block start
+            auto lanes = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)table.lanes[mask]), zero);
+            auto base = _mm_set1_epi32((int)i);
+            _mm_storeu_si128((__m128i*)(out + count), _mm_add_epi32(_mm_unpacklo_epi16(lanes, zero), base));
+            _mm_storeu_si128((__m128i*)(out + count + 4), _mm_add_epi32(_mm_unpackhi_epi16(lanes, zero), base));
+            count += table.count[mask];
+        }
+#endif
+        for (; i < size; ++i)
+        {
+            if (depth[i]) out[count++] = (int)i;
+        }
+        return count;
+    }
+
+    // In-place gather of the valid elements to the front, valid indices are ascending so no element is overwritten before being read
+    template<class T> void compact(T* items, const int* valid, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            items[i] = items[valid[i]];
+    }
+
+    void pack_points(const float3* vertices, const float2* tex, size_t count, rs2_format format, float vertex_scale,
+        uint16_t* packed_vertices, uint16_t* packed_tex)
+    {
+        if (format == RS2_FORMAT_XYZ16)
+        {
+            auto inv_scale = 1.f / vertex_scale;
+            for (size_t i = 0; i < count; ++i)
+            {
+                packed_vertices[i * 3 + 0] = static_cast<uint16_t>(float_to_fixed16(vertices[i].x, inv_scale));
+                packed_vertices[i * 3 + 1] = static_cast<uint16_t>(float_to_fixed16(vertices[i].y, inv_scale));
+                packed_vertices[i * 3 + 2] = static_cast<uint16_t>(float_to_fixed16(vertices[i].z, inv_scale));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                packed_vertices[i * 3 + 0] = float_to_half(vertices[i].x);
+                packed_vertices[i * 3 + 1] = float_to_half(vertices[i].y);
+                packed_vertices[i * 3 + 2] = float_to_half(vertices[i].z);
+            }
+        }
+
+        if (!tex)
+        {
+            memset(packed_tex, 0, count * 2 * sizeof(uint16_t));
+            return;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            packed_tex[i * 2 + 0] = float_to_unorm16(tex[i].x);
+            packed_tex[i * 2 + 1] = float_to_unorm16(tex[i].y);
+        }
+    }
+
+    rs2_format pointcloud::get_vertex_format() const
+    {
+        switch (_vertex_format)
+        {
+        case vertex_format_xyz16: return RS2_FORMAT_XYZ16;
+        case vertex_format_xyz16f: return RS2_FORMAT_XYZ16F;
+        default: return RS2_FORMAT_XYZ32F;
+        }
+    }
+
     void pointcloud::set_extrinsics()
     {
         if (_output_stream && _other_stream && !_extrinsics)
@@ -67,9 +171,12 @@ namespace librealsense
 
     void pointcloud::inspect_depth_frame(const rs2::frame& depth)
     {
-        if (!_output_stream || _depth_stream.get_profile().get() != depth.get_profile().get())
+        auto format = get_vertex_format();
+        if (!_output_stream || _depth_stream.get_profile().get() != depth.get_profile().get() || _output_stream.format() != format)
         {
             _output_stream = depth.get_profile().as<rs2::video_stream_profile>().clone(
+                RS2_STREAM_DEPTH, depth.get_profile().stream_index(), format);
+            _float_stream = format == RS2_FORMAT_XYZ32F ? _output_stream : depth.get_profile().as<rs2::video_stream_profile>().clone(
                 RS2_STREAM_DEPTH, depth.get_profile().stream_index(), RS2_FORMAT_XYZ32F);
             _depth_stream = depth;
             _depth_intrinsics = optional_value<rs2_intrinsics>();
@@ -175,12 +282,135 @@ namespace librealsense
 
     rs2::frame pointcloud::process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth)
     {
+        auto format = _output_stream.format();
         auto res = allocate_points(source, depth);
         auto pframe = (librealsense::points*)(res.get());
+        pframe->set_vertex_scale(format == RS2_FORMAT_XYZ16 ? _vertex_scale : 1.f);
+        if (format == RS2_FORMAT_XYZ32F)
+        {
+            compute_points(res, depth);
+            return res;
+        }
+
+        auto vid_frame = depth.as<rs2::video_frame>();
+        size_t count = vid_frame.get_width() * vid_frame.get_height();
+        bool map_texture = _extrinsics && _other_intrinsics;
+        auto sparse = static_cast<sparse_output_mode>(_sparse_output);
+
+        // The packed point cloud is computed directly from the depth pixels, unless the occlusion filter needs
+        // the float point cloud and texel map to work on
+        bool fused = false;
+        if (!(map_texture && _occlusion_filter->active()))
+        {
+            auto depth_data = (const uint16_t*)depth.get_data();
+            if (sparse != sparse_none)
+                count = find_valid_pixels(depth_data, count, _valid_pixels);
+
+            fused = depth_to_packed_points(pframe, depth_data, *_depth_units,
+                sparse != sparse_none ? _valid_pixels.data() : nullptr, count,
+                map_texture ? &_other_intrinsics.value() : nullptr,
+                map_texture ? &_extrinsics.value() : nullptr);
+        }
+
+        if (!fused)
+        {
+            // Compute the float point cloud in a frame of its own, recycled by the frame pool, and convert it
+            auto float_points = source.allocate_points(_float_stream, depth);
+            compute_points(float_points, depth);
+            auto float_frame = (librealsense::points*)(float_points.get());
+            count = float_frame->get_vertex_count();
+            pack_points(float_frame->get_vertices(), map_texture ? float_frame->get_texture_coordinates() : nullptr,
+                count, format, pframe->get_vertex_scale(),
+                (uint16_t*)pframe->get_vertex_data(), (uint16_t*)pframe->get_texture_coordinate_data());
+        }
+
+        if (sparse != sparse_none)
+            pframe->resize(count);
+        if (sparse == sparse_valid_points_with_indices)
+            pframe->set_pixel_indices(_valid_pixels.data(), count);
+        else
+            pframe->set_pixel_indices(nullptr, 0);
+
+        return res;
+    }
+
+    rs2::frame pointcloud::process_depth_roi(const rs2::frame_source& source, const rs2::depth_frame& depth)
+    {
+        if (!_roi.is_set())
+        {
+            inspect_depth_frame(depth);
+            return process_depth_frame(source, depth);
+        }
+
+        // Only the pixels of the region of interest are deprojected, its points are the output when cropping
+        auto width = depth.get_width();
+        auto height = depth.get_height();
+        auto rect = _roi.get(width, height);
+        auto cropped = _roi.crop_frame(source, depth, rect, RS2_EXTENSION_DEPTH_FRAME);
+        if (!cropped)
+            return rs2::frame();
+
+        inspect_depth_frame(cropped);
+        auto roi_points = process_depth_frame(source, cropped);
+        if (_roi.crop())
+            return roi_points;
+
+        // Otherwise they take their place in a point cloud of the whole frame, of no depth elsewhere
+        auto format = get_vertex_format();
+        if (!_uncropped_stream || _uncropped_depth.get() != depth.get_profile().get() || _uncropped_stream.format() != format)
+        {
+            _uncropped_depth = depth.get_profile();
+            _uncropped_stream = _uncropped_depth.clone(RS2_STREAM_DEPTH, _uncropped_depth.stream_index(), format);
+        }
+
+        auto res = source.allocate_points(_uncropped_stream, depth);
+        auto from = (librealsense::points*)(roi_points.get());
+        auto to = (librealsense::points*)(res.get());
+        to->set_vertex_scale(from->get_vertex_scale());
+
+        auto vertex_size = points::get_vertex_size(format);
+        auto tex_size = points::get_texture_coordinate_size(format);
+        auto count = from->get_vertex_count();
+
+        if (static_cast<sparse_output_mode>(_sparse_output) != sparse_none)
+        {
+            // Sparse point clouds keep their points, with the pixel indices of the whole frame
+            memcpy(to->get_vertex_data(), from->get_vertex_data(), count * vertex_size);
+            memcpy(to->get_texture_coordinate_data(), from->get_texture_coordinate_data(), count * tex_size);
+            to->resize(count);
+
+            if (auto indices = from->get_pixel_indices())
+            {
+                std::vector<int> frame_indices(count);
+                for (size_t i = 0; i < count; ++i)
+                    frame_indices[i] = (rect.y + indices[i] / rect.width) * width + rect.x + indices[i] % rect.width;
+                to->set_pixel_indices(frame_indices.data(), count);
+            }
+            else
+                to->set_pixel_indices(nullptr, 0);
+            return res;
+        }
+
+        auto vertices = to->get_vertex_data();
+        auto tex = to->get_texture_coordinate_data();
+        memset(vertices, 0, width * height * points::get_point_size(format));
+        copy_rows(vertices + (rect.y * width + rect.x) * vertex_size, width * vertex_size,
+            from->get_vertex_data(), rect.width * vertex_size, rect.width * vertex_size, rect.height);
+        copy_rows(tex + (rect.y * width + rect.x) * tex_size, width * tex_size,
+            from->get_texture_coordinate_data(), rect.width * tex_size, rect.width * tex_size, rect.height);
+        to->set_pixel_indices(nullptr, 0);
+        return res;
+    }
+
+    void pointcloud::compute_points(rs2::points res, const rs2::depth_frame& depth)
+    {
+        auto pframe = (librealsense::points*)(res.get());
 
         const float3* points = depth_to_points(res, *_depth_intrinsics, depth, *_depth_units);
 
         auto vid_frame = depth.as<rs2::video_frame>();
+        auto height = vid_frame.get_height();
+        auto width = vid_frame.get_width();
 
         // Pixels calculated in the mapped texture. Used in post-processing filters
         float2* pixels_ptr = _pixels_map.data();
@@ -196,19 +426,46 @@ namespace librealsense
             }
         }
 
+        auto sparse = static_cast<sparse_output_mode>(_sparse_output);
+        size_t valid_count = 0;
+        if (sparse != sparse_none)
+            valid_count = find_valid_pixels((const uint16_t*)depth.get_data(), width * height, _valid_pixels);
+
+        // The occlusion filter works on the full pixel grid. Without it the valid points are compacted
+        // before texture mapping, so that only they get projected
+        bool compact_first = sparse != sparse_none && !(map_texture && _occlusion_filter->active());
+        if (compact_first)
+            compact(pframe->get_vertices(), _valid_pixels.data(), valid_count);
+
         if (map_texture)
         {
-            auto height = vid_frame.get_height();
-            auto width = vid_frame.get_width();
+            if (compact_first)
+            {
+                get_texture_map(res, points, static_cast<unsigned int>(valid_count), 1, mapped_intr, extr, pixels_ptr);
+            }
+            else
+            {
+                get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
 
-            get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
+                if (_occlusion_filter->active())
+                {
+                    _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map);
+                }
 
-            if (_occlusion_filter->active())
-            {
-                _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map);
+                if (sparse != sparse_none)
+                {
+                    compact(pframe->get_vertices(), _valid_pixels.data(), valid_count);
+                    compact(pframe->get_texture_coordinates(), _valid_pixels.data(), valid_count);
+                }
             }
         }
-        return res;
+
+        if (sparse != sparse_none)
+            pframe->resize(valid_count);
+        if (sparse == sparse_valid_points_with_indices)
+            pframe->set_pixel_indices(_valid_pixels.data(), valid_count);
+        else
+            pframe->set_pixel_indices(nullptr, 0);
     }
 
     pointcloud::pointcloud()
@@ -216,7 +473,9 @@ namespace librealsense
     {}
 
     pointcloud::pointcloud(const char* name)
-        : stream_filter_processing_block(name)
+        : stream_filter_processing_block(name), _sparse_output(sparse_none),
+        _vertex_format(vertex_format_xyz32f), _vertex_scale(0.001f),
+        _roi(*this, _mutex)
     {
         _occlusion_filter = std::make_shared<occlusion_filter>();
 
@@ -240,6 +499,40 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Heuristic");
         occlusion_invalidation->set_description(2.f, "Exhaustive");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+
+        auto occlusion_decimation = std::make_shared<ptr_option<uint8_t>>(
+            1, 8, 1, 1,
+            &_occlusion_filter->_texel_decimation,
+            "Texel cell size of the exhaustive occlusion removal, trades accuracy for speed");
+        register_option(RS2_OPTION_OCCLUSION_DECIMATION, occlusion_decimation);
+
+        auto sparse_output = std::make_shared<ptr_option<uint8_t>>(
+            sparse_none,
+            sparse_max - 1, 1,
+            sparse_none,
+            &_sparse_output,
+            "Emit only the points with valid depth");
+        sparse_output->set_description(0.f, "Off");
+        sparse_output->set_description(1.f, "Valid points");
+        sparse_output->set_description(2.f, "Valid points and pixel indices");
+        register_option(RS2_OPTION_SPARSE_OUTPUT, sparse_output);
+
+        auto vertex_format = std::make_shared<ptr_option<uint8_t>>(
+            vertex_format_xyz32f,
+            vertex_format_max - 1, 1,
+            vertex_format_xyz32f,
+            &_vertex_format,
+            "Vertex and texture coordinate format of the point cloud");
+        vertex_format->set_description(0.f, "XYZ32F");
+        vertex_format->set_description(1.f, "XYZ16");
+        vertex_format->set_description(2.f, "XYZ16F");
+        register_option(RS2_OPTION_VERTEX_FORMAT, vertex_format);
+
+        auto vertex_scale = std::make_shared<ptr_option<float>>(
+            0.0001f, 0.01f, 0.0001f, 0.001f,
+            &_vertex_scale,
+            "Meters per unit of XYZ16 vertices");
+        register_option(RS2_OPTION_VERTEX_SCALE, vertex_scale);
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
@@ -292,15 +585,13 @@ namespace librealsense
             inspect_other_frame(texture);
 
             auto depth = composite.first(RS2_STREAM_DEPTH, RS2_FORMAT_Z16);
-            inspect_depth_frame(depth);
-            rv = process_depth_frame(source, depth);
+            rv = process_depth_roi(source, depth);
         }
         else
         {
             if (f.is<rs2::depth_frame>())
             {
-                inspect_depth_frame(f);
-                rv = process_depth_frame(source, f);
+                rv = process_depth_roi(source, f);
             }
             if (f.get_profile().stream_type() == _stream_filter.stream && f.get_profile().format() == _stream_filter.format)
             {
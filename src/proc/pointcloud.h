@@ -4,11 +4,85 @@
 #pragma once
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "synthetic-stream.h"
+#include "processing-roi.h"
+
+#include <cmath>
+#include <cstring>
 
 namespace librealsense
 {
     class occlusion_filter;
 
+    enum sparse_output_mode : uint8_t {
+        sparse_none,
+        sparse_valid_points,
+        sparse_valid_points_with_indices,
+        sparse_max };
+
+    // Stream compaction of the non-zero depth pixels, writes their indices to valid and returns their count
+    size_t find_valid_pixels(const uint16_t* depth, size_t size, std::vector<int>& valid);
+
+    enum vertex_format_mode : uint8_t {
+        vertex_format_xyz32f,
+        vertex_format_xyz16,
+        vertex_format_xyz16f,
+        vertex_format_max };
+
+    // Scalar conversions to the packed vertex formats, the SIMD kernels produce the same values
+
+    // IEEE half precision, rounded to nearest even
+    inline uint16_t float_to_half(float value)
+    {
+        uint32_t f;
+        memcpy(&f, &value, sizeof(f));
+        uint32_t sign = f & 0x80000000u;
+        f ^= sign;
+
+        uint16_t h;
+        if (f >= 0x47800000u) // Beyond the half range, Inf or NaN
+        {
+            h = f > 0x7f800000u ? 0x7e00 : 0x7c00;
+        }
+        else if (f < 0x38800000u) // Subnormal half, let the float addition round the mantissa
+        {
+            const uint32_t magic = 126u << 23;
+            float v, m;
+            memcpy(&v, &f, sizeof(v));
+            memcpy(&m, &magic, sizeof(m));
+            v += m;
+            memcpy(&f, &v, sizeof(f));
+            h = static_cast<uint16_t>(f - magic);
+        }
+        else
+        {
+            uint32_t mant_odd = (f >> 13) & 1;
+            f += 0xc8000fffu + mant_odd; // Rebias the exponent and round the mantissa
+            h = static_cast<uint16_t>(f >> 13);
+        }
+        return h | static_cast<uint16_t>(sign >> 16);
+    }
+
+    // Fixed point in units of 1 / inv_scale, saturated to the int16 range
+    inline int16_t float_to_fixed16(float value, float inv_scale)
+    {
+        auto v = value * inv_scale;
+        if (!(v > -2147483648.f && v < 2147483648.f)) return INT16_MIN;
+        auto i = std::nearbyint(v);
+        return static_cast<int16_t>(i < INT16_MIN ? INT16_MIN : (i > INT16_MAX ? INT16_MAX : i));
+    }
+
+    // Normalized texture coordinate, clamped to [0, 1]
+    inline uint16_t float_to_unorm16(float value)
+    {
+        value = value > 0.f ? value : 0.f;
+        value = value < 1.f ? value : 1.f;
+        return static_cast<uint16_t>(std::nearbyint(value * 65535.f));
+    }
+
+    // Convert float vertices and texture coordinates to a packed vertex format, texture coordinates are zeroed when tex is nullptr
+    void pack_points(const float3* vertices, const float2* tex, size_t count, rs2_format format, float vertex_scale,
+        uint16_t* packed_vertices, uint16_t* packed_tex);
+
     class LRS_EXTENSION_API pointcloud : public stream_filter_processing_block
     {
     public:
@@ -32,6 +106,18 @@ namespace librealsense
         virtual rs2::points allocate_points(const rs2::frame_source& source, const rs2::frame& f);
         virtual void preprocess() {}
 
+        // Deprojection fused with the conversion to the packed vertex format of output, for blocks that have it.
+        // indices selects the depth pixels to convert, all of them when nullptr. Texture coordinates are computed
+        // when other_intrinsics is set. Returns false to have the float point cloud converted instead
+        virtual bool depth_to_packed_points(
+            librealsense::points* output,
+            const uint16_t* depth,
+            float depth_scale,
+            const int* indices,
+            size_t count,
+            const rs2_intrinsics* other_intrinsics,
+            const rs2_extrinsics* extr) { return false; }
+
     protected:
         pointcloud(const char* name);
 
@@ -47,13 +133,28 @@ namespace librealsense
         // Intermediate translation table of (depth_x*depth_y) with actual texel coordinates per depth pixel
         std::vector<float2>                    _pixels_map;
 
+        uint8_t                                _sparse_output;
+        std::vector<int>                       _valid_pixels; // Indices of the non-zero depth pixels, for sparse output
+
+        uint8_t                                _vertex_format;
+        float                                  _vertex_scale; // Meters per unit of RS2_FORMAT_XYZ16 vertices
+
         rs2::stream_profile _output_stream;
+        rs2::stream_profile _float_stream; // RS2_FORMAT_XYZ32F profile of the intermediate point cloud of packed formats
         rs2::frame _other_stream;
         rs2::frame _depth_stream;
 
+        // The point cloud of a region of interest is computed from a cropped copy of the depth frame
+        processing_roi _roi;
+        rs2::stream_profile _uncropped_stream; // Output profile of the whole depth frame when not cropping
+        rs2::stream_profile _uncropped_depth;
+
         void inspect_depth_frame(const rs2::frame& depth);
         void inspect_other_frame(const rs2::frame& other);
+        rs2::frame process_depth_roi(const rs2::frame_source& source, const rs2::depth_frame& depth);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
+        void compute_points(rs2::points res, const rs2::depth_frame& depth);
+        rs2_format get_vertex_format() const;
         void set_extrinsics();
 
         stream_filter _prev_stream_filter;
@@ -0,0 +1,172 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "../include/librealsense2/hpp/rs_processing.hpp"
+
+#include "proc/synthetic-stream.h"
+#include "proc/processing-batch.h"
+
+namespace librealsense
+{
+    static int batch_workers(int threads)
+    {
+        if (threads < 0)
+            throw invalid_value_exception(to_string() << "Processing batch requires a positive number of threads, " << threads << " requested");
+        return threads ? threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    processing_batch::processing_batch(int threads)
+        : processing_block("Processing Batch"),
+        _invoked(0),
+        _delivered(0),
+        // Bounded by the default frame pool of a block, a single block may hold all the frames in flight
+        _max_in_flight(std::min(2 * batch_workers(threads), 16)),
+        // The invoking thread does not take part in the work, the pool gets one worker per thread
+        _workers(batch_workers(threads) + 1)
+    {
+        auto on_frame = [this](rs2::frame f, const rs2::frame_source& source)
+        {
+            // The frame is handed over to the worker, so that the stages may process it in place
+            auto holder = std::make_shared<rs2::frame>(std::move(f));
+
+            std::unique_lock<std::mutex> lock(_batch_mutex);
+            _state_changed.wait(lock, [this]() { return _invoked - _delivered < static_cast<unsigned long long>(_max_in_flight); });
+            auto index = _invoked++;
+
+            // Queued in index order, so that the workers never wait in an ordered stage for a frame still in the queue
+            _workers.submit([this, holder, index]()
+            {
+                process(std::move(*holder), index);
+            });
+        };
+
+        auto callback = new rs2::frame_processor_callback<decltype(on_frame)>(on_frame);
+        processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
+    }
+
+    processing_batch::~processing_batch()
+    {
+        flush();
+    }
+
+    void processing_batch::add_stage(const std::vector<std::shared_ptr<processing_block_interface>>& blocks, bool ordered)
+    {
+        if (blocks.empty())
+            throw invalid_value_exception("Processing batch stage requires at least one block");
+        if (ordered && blocks.size() > 1)
+            throw invalid_value_exception(to_string() << "Ordered processing batch stage runs a single block, " << blocks.size() << " given");
+        for (auto&& block : blocks)
+            if (!block)
+                throw invalid_value_exception("Processing batch block is null");
+
+        // The stages change between frames only
+        std::unique_lock<std::mutex> lock(_batch_mutex);
+        _state_changed.wait(lock, [this]() { return _invoked == _delivered; });
+
+        std::unique_ptr<stage> s(new stage());
+        s->ordered = ordered;
+        s->next = _invoked;
+        for (auto&& block : blocks)
+        {
+            auto r = std::make_shared<replica>();
+            r->block = block;
+
+            // Blocks deliver their output synchronously on the invoking thread.
+            // The blocks belong to the caller, the output of an invocation after the batch is gone is dropped
+            std::weak_ptr<replica> target = r;
+            auto on_output = [target](frame_interface* f)
+            {
+                rs2::frame output((rs2_frame*)f);
+                if (auto r = target.lock())
+                    r->result = std::move(output);
+            };
+            block->set_output_callback(std::make_shared<internal_frame_callback<decltype(on_output)>>(on_output));
+
+            s->idle.push_back(r.get());
+            s->replicas.push_back(std::move(r));
+        }
+        _stages.push_back(std::move(s));
+    }
+
+    void processing_batch::flush()
+    {
+        std::unique_lock<std::mutex> lock(_batch_mutex);
+        _state_changed.wait(lock, [this]() { return _invoked == _delivered; });
+    }
+
+    rs2::frame processing_batch::run_stage(stage& s, rs2::frame input, unsigned long long index)
+    {
+        replica* r;
+        {
+            std::unique_lock<std::mutex> lock(_batch_mutex);
+            _state_changed.wait(lock, [&]() { return s.ordered ? s.next == index : !s.idle.empty(); });
+            r = s.ordered ? s.replicas.front().get() : s.idle.back();
+            if (!s.ordered)
+                s.idle.pop_back();
+        }
+
+        rs2::frame out;
+        try
+        {
+            auto fi = (frame_interface*)input.get();
+            if (fi)
+            {
+                // The only reference of the batch goes to the block, a block that produces nothing drops the frame
+                fi->acquire();
+                input = rs2::frame();
+                r->block->invoke(frame_holder(fi));
+
+                out = std::move(r->result);
+                r->result = rs2::frame();
+            }
+        }
+        catch (...)
+        {
+            LOG_ERROR("Exception was thrown by processing batch stage!");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_batch_mutex);
+            if (s.ordered)
+                ++s.next;
+            else
+                s.idle.push_back(r);
+        }
+        _state_changed.notify_all();
+        return out;
+    }
+
+    void processing_batch::process(rs2::frame f, unsigned long long index)
+    {
+        // Every stage sees every frame index, so that the ordered stages move on after a frame failed
+        for (auto&& s : _stages)
+            f = run_stage(*s, std::move(f), index);
+
+        deliver(std::move(f), index);
+    }
+
+    void processing_batch::deliver(rs2::frame f, unsigned long long index)
+    {
+        std::lock_guard<std::mutex> delivery_lock(_delivery_mutex);
+        _done[index] = std::move(f);
+
+        // The frames are delivered in order by whichever worker completes the next one
+        for (auto it = _done.begin(); it != _done.end() && it->first == _delivered; it = _done.begin())
+        {
+            auto out = std::move(it->second);
+            _done.erase(it);
+            if (auto fi = (frame_interface*)out.get())
+            {
+                fi->acquire();
+                out = rs2::frame();
+                _source_wrapper.frame_ready(frame_holder(fi));
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_batch_mutex);
+                ++_delivered;
+            }
+            _state_changed.notify_all();
+        }
+    }
+}
@@ -0,0 +1,65 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "concurrency.h"
+
+#include <condition_variable>
+
+namespace librealsense
+{
+    // Runs a sequence of processing stages over a stream of frames on a set of worker threads, for offline processing.
+    // A parallel stage holds several blocks configured alike and processes as many frames at once, each frame on one
+    // of its blocks. An ordered stage holds a single block, for the blocks keeping state between frames such as the
+    // temporal filter, and processes the frames one at a time in their invocation order. The frames move on to the
+    // next stage as soon as they are done with one, so that the ordered stages are pipelined with the others.
+    // The frames are delivered in their invocation order, a stage producing nothing for a frame drops it.
+    // At most twice the number of workers frames, up to 16, are in the batch at once, further invocations wait for one
+    // of them to be delivered
+    class processing_batch : public processing_block
+    {
+    public:
+        // threads is the number of workers, all the cores when 0
+        processing_batch(int threads);
+        ~processing_batch();
+
+        // Appends a stage to the batch, the output of the blocks is redirected to the batch
+        void add_stage(const std::vector<std::shared_ptr<processing_block_interface>>& blocks, bool ordered);
+
+        // Waits for the frames invoked so far to be delivered
+        void flush();
+
+    private:
+        struct replica
+        {
+            std::shared_ptr<processing_block_interface> block;
+            rs2::frame result;  // Output of the current invocation, the replica processes one frame at a time
+        };
+
+        struct stage
+        {
+            std::vector<std::shared_ptr<replica>> replicas;
+            std::vector<replica*> idle;
+            bool ordered;
+            unsigned long long next;    // Index of the next frame an ordered stage processes
+        };
+
+        void process(rs2::frame f, unsigned long long index);
+        rs2::frame run_stage(stage& s, rs2::frame input, unsigned long long index);
+        void deliver(rs2::frame f, unsigned long long index);
+
+        std::mutex _batch_mutex;    // Guards the stages and the frames in flight
+        std::condition_variable _state_changed;
+        std::vector<std::unique_ptr<stage>> _stages;
+        unsigned long long _invoked;
+        unsigned long long _delivered;
+        int _max_in_flight;
+
+        std::mutex _delivery_mutex;
+        std::map<unsigned long long, rs2::frame> _done;  // Frames processed ahead of an earlier frame, by index
+
+        thread_pool _workers;   // Last, so that the workers are gone before the state they use
+    };
+}
@@ -0,0 +1,181 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "../include/librealsense2/hpp/rs_processing.hpp"
+
+#include "concurrency.h"
+#include "proc/synthetic-stream.h"
+#include "proc/processing-graph.h"
+
+namespace librealsense
+{
+    processing_graph::processing_graph(int max_in_flight)
+        : processing_block("Processing Graph"),
+        _max_in_flight(max_in_flight),
+        _in_flight(0)
+    {
+        if (max_in_flight < 1)
+            throw invalid_value_exception(to_string() << "Processing graph requires at least one frame in flight, " << max_in_flight << " requested");
+
+        auto on_frame = [this](rs2::frame f, const rs2::frame_source& source)
+        {
+            auto out = process(source, f);
+            if (out)
+                source.frame_ready(out);
+        };
+
+        auto callback = new rs2::frame_processor_callback<decltype(on_frame)>(on_frame);
+        processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
+    }
+
+    int processing_graph::add(std::shared_ptr<processing_block_interface> block, const std::vector<int>& inputs)
+    {
+        if (!block)
+            throw invalid_value_exception("Processing graph block is null");
+
+        // The graph changes between frames only
+        std::unique_lock<std::mutex> lock(_graph_mutex);
+        _frame_done.wait(lock, [this]() { return _in_flight == 0; });
+
+        int id = static_cast<int>(_nodes.size());
+        int level = 0;
+        for (auto input : inputs)
+        {
+            if (input < 0 || input >= id)
+                throw invalid_value_exception(to_string() << "Processing graph node " << input << " does not exist");
+            level = std::max(level, _node_levels[input] + 1);
+        }
+
+        std::unique_ptr<node> n(new node());
+        n->block = block;
+        n->inputs = inputs;
+        n->sink = true;
+
+        // Blocks deliver their output synchronously on the invoking thread
+        auto target = n.get();
+        auto on_output = [target](frame_interface* f)
+        {
+            rs2::frame result((rs2_frame*)f);
+            std::lock_guard<std::mutex> lock(target->results_mutex);
+            target->results[std::this_thread::get_id()] = result;
+        };
+        block->set_output_callback(std::make_shared<internal_frame_callback<decltype(on_output)>>(on_output));
+
+        for (auto input : inputs)
+            _nodes[input]->sink = false;
+        _nodes.push_back(std::move(n));
+        _node_levels.push_back(level);
+        if (level >= static_cast<int>(_levels.size()))
+            _levels.resize(level + 1);
+        _levels[level].push_back(id);
+
+        return id;
+    }
+
+    rs2::frame processing_graph::run_node(node& n, const rs2::frame& input)
+    {
+        auto fi = (frame_interface*)input.get();
+        fi->acquire();
+        n.block->invoke(frame_holder(fi));
+
+        std::lock_guard<std::mutex> lock(n.results_mutex);
+        auto it = n.results.find(std::this_thread::get_id());
+        // A block that produced nothing passes its input on
+        if (it == n.results.end())
+            return input;
+
+        auto result = it->second;
+        n.results.erase(it);
+        return result;
+    }
+
+    rs2::frame processing_graph::combine(const rs2::frame_source& source, const std::vector<rs2::frame>& frames)
+    {
+        // Flatten the framesets, the frames several blocks pass through are kept once
+        std::vector<rs2::frame> unique;
+        auto add = [&unique](const rs2::frame& f)
+        {
+            for (auto&& u : unique)
+                if (u.get() == f.get())
+                    return;
+            unique.push_back(f);
+        };
+        for (auto&& f : frames)
+        {
+            if (auto fs = f.as<rs2::frameset>())
+            {
+                for (auto&& sub : fs)
+                    add(sub);
+            }
+            else if (f)
+                add(f);
+        }
+
+        if (unique.size() == 1)
+            return unique.front();
+        return source.allocate_composite_frame(unique);
+    }
+
+    rs2::frame processing_graph::process(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_graph_mutex);
+            _frame_done.wait(lock, [this]() { return _in_flight < _max_in_flight; });
+            ++_in_flight;
+        }
+
+        auto complete = [this]()
+        {
+            std::lock_guard<std::mutex> lock(_graph_mutex);
+            --_in_flight;
+            _frame_done.notify_all();
+        };
+
+        rs2::frame out;
+        try
+        {
+            if (_nodes.empty())
+            {
+                complete();
+                return f;
+            }
+
+            std::vector<rs2::frame> outputs(_nodes.size());
+            for (auto&& level : _levels)
+            {
+                thread_pool::get_default().parallel_for(0, static_cast<int>(level.size()), [&](int first, int last)
+                {
+                    for (int i = first; i < last; ++i)
+                    {
+                        auto& n = *_nodes[level[i]];
+                        rs2::frame input = f;
+                        if (n.inputs.size() == 1)
+                            input = outputs[n.inputs.front()];
+                        else if (n.inputs.size() > 1)
+                        {
+                            std::vector<rs2::frame> frames;
+                            for (auto in : n.inputs)
+                                frames.push_back(outputs[in]);
+                            input = combine(source, frames);
+                        }
+                        outputs[level[i]] = run_node(n, input);
+                    }
+                });
+            }
+
+            std::vector<rs2::frame> results;
+            for (size_t i = 0; i < _nodes.size(); ++i)
+                if (_nodes[i]->sink)
+                    results.push_back(outputs[i]);
+            out = combine(source, results);
+        }
+        catch (...)
+        {
+            complete();
+            throw;
+        }
+
+        complete();
+        return out;
+    }
+}
@@ -0,0 +1,51 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <condition_variable>
+#include <thread>
+
+namespace librealsense
+{
+    // Runs a set of processing blocks over every input frame as a dependency graph.
+    // A block consumes the output of the blocks it depends on, or the graph input when there are none, and the
+    // blocks whose inputs are ready run concurrently on the default thread pool. The graph output is a composite
+    // of the frames produced by the blocks nothing depends on.
+    // At most max_in_flight frames go through the graph at once, further invocations wait for one of them to complete
+    class processing_graph : public processing_block
+    {
+    public:
+        processing_graph(int max_in_flight);
+
+        // Adds block to the graph, consuming the output of the inputs nodes, the graph input when empty.
+        // Returns the node of the block, the block output is redirected to the graph
+        int add(std::shared_ptr<processing_block_interface> block, const std::vector<int>& inputs);
+
+    private:
+        struct node
+        {
+            std::shared_ptr<processing_block_interface> block;
+            std::vector<int> inputs;
+            bool sink;
+
+            // Output of the invocations in progress by invoking thread, a block may run for several frames at once
+            std::mutex results_mutex;
+            std::map<std::thread::id, rs2::frame> results;
+        };
+
+        rs2::frame process(const rs2::frame_source& source, const rs2::frame& f);
+        rs2::frame run_node(node& n, const rs2::frame& input);
+        rs2::frame combine(const rs2::frame_source& source, const std::vector<rs2::frame>& frames);
+
+        std::mutex _graph_mutex;    // Guards the graph structure and the frames in flight
+        std::condition_variable _frame_done;
+        std::vector<std::unique_ptr<node>> _nodes;
+        std::vector<std::vector<int>> _levels;  // Nodes by depth, the nodes of a level only depend on the previous levels
+        std::vector<int> _node_levels;
+        int _max_in_flight;
+        int _in_flight;
+    };
+}
@@ -0,0 +1,194 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#include "option.h"
+#include "proc/processing-roi.h"
+#include "context.h"
+
+namespace librealsense
+{
+    static const size_t max_cropped_profiles = 16;
+
+    // A bound of the region of interest, rejecting values that would cross the opposite bound
+    class roi_bound_option : public option_base
+    {
+    public:
+        roi_bound_option(float* value, const float* opposite, bool is_min, std::mutex& mutex,
+            std::function<void()> on_change, const std::string& desc)
+            : option_base({ 0.f, 1.f, 0.01f, is_min ? 0.f : 1.f }),
+            _value(value), _opposite(opposite), _is_min(is_min), _mutex(mutex), _on_change(on_change), _desc(desc)
+        {}
+
+        void set(float value) override
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (value < _opt_range.min || value > _opt_range.max)
+                throw invalid_value_exception(to_string() << "Region of interest bound " << value << " is out of range.");
+            if (_is_min ? value >= *_opposite : value <= *_opposite)
+                throw invalid_value_exception(to_string() << "Region of interest " << (_is_min ? "min " : "max ") << value
+                    << " must be " << (_is_min ? "below" : "above") << " the opposite bound " << *_opposite);
+
+            *_value = value;
+            _on_change();
+        }
+
+        float query() const override { return *_value; }
+        bool is_enabled() const override { return true; }
+        const char* get_description() const override { return _desc.c_str(); }
+
+    private:
+        float* _value;
+        const float* _opposite;
+        bool _is_min;
+        std::mutex& _mutex;
+        std::function<void()> _on_change;
+        std::string _desc;
+    };
+
+    processing_roi::processing_roi(options_container& block, std::mutex& mutex, std::function<void()> on_change)
+        : _min_x(0.f), _min_y(0.f), _max_x(1.f), _max_y(1.f), _crop(false)
+    {
+        block.register_option(RS2_OPTION_ROI_MIN_X, std::make_shared<roi_bound_option>(&_min_x, &_max_x, true, mutex, on_change,
+            "Left edge of the region of interest, as a fraction of the frame width"));
+        block.register_option(RS2_OPTION_ROI_MIN_Y, std::make_shared<roi_bound_option>(&_min_y, &_max_y, true, mutex, on_change,
+            "Top edge of the region of interest, as a fraction of the frame height"));
+        block.register_option(RS2_OPTION_ROI_MAX_X, std::make_shared<roi_bound_option>(&_max_x, &_min_x, false, mutex, on_change,
+            "Right edge of the region of interest, as a fraction of the frame width"));
+        block.register_option(RS2_OPTION_ROI_MAX_Y, std::make_shared<roi_bound_option>(&_max_y, &_min_y, false, mutex, on_change,
+            "Bottom edge of the region of interest, as a fraction of the frame height"));
+
+        auto crop = std::make_shared<ptr_option<bool>>(false, true, true, false, &_crop, "Crop the output frame to the region of interest");
+        crop->on_set([&mutex, on_change](float val)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            on_change();
+        });
+        block.register_option(RS2_OPTION_ROI_CROP, crop);
+    }
+
+    bool processing_roi::cropped_profile_key::operator<(const cropped_profile_key& other) const
+    {
+        return std::make_tuple(unique_id, format, width, height, rect.x, rect.y, rect.width, rect.height) <
+            std::make_tuple(other.unique_id, other.format, other.width, other.height, other.rect.x, other.rect.y, other.rect.width, other.rect.height);
+    }
+
+    bool processing_roi::is_set() const
+    {
+        return _min_x > 0.f || _min_y > 0.f || _max_x < 1.f || _max_y < 1.f;
+    }
+
+    pixel_rect processing_roi::get(int width, int height, int align) const
+    {
+        if (!is_set())
+            return{ 0, 0, width, height };
+
+        // The region is made of whole align x align cells, the partial cells at the frame edge are left out
+        const int min_cells = align > 1 ? 1 : 2;
+        auto range = [min_cells, align](float min, float max, int size, int& first, int& count)
+        {
+            int cells = size / align;
+            if (cells < min_cells)
+            {
+                first = 0;
+                count = size;
+                return;
+            }
+            int begin = std::min(static_cast<int>(std::floor(min * size / align)), cells - min_cells);
+            int end = std::min(static_cast<int>(std::ceil(max * size / align)), cells);
+            end = std::max(end, begin + min_cells);
+            first = begin * align;
+            count = (end - begin) * align;
+        };
+
+        pixel_rect rect;
+        range(_min_x, _max_x, width, rect.x, rect.width);
+        range(_min_y, _max_y, height, rect.y, rect.height);
+        return rect;
+    }
+
+    rs2::stream_profile processing_roi::get_cropped_profile(const rs2::stream_profile& profile, const pixel_rect& rect)
+    {
+        auto vp = profile.as<rs2::video_stream_profile>();
+        const stream_interface* source = profile.get()->profile;
+        cropped_profile_key key{ vp.unique_id(), vp.format(), vp.width(), vp.height(), rect };
+        auto it = _cropped_profiles.find(key);
+        if (it != _cropped_profiles.end() && it->second.source.lock().get() == source)
+            return it->second.profile;
+
+        auto intrin = vp.get_intrinsics();
+        intrin.width = rect.width;
+        intrin.height = rect.height;
+        intrin.ppx -= rect.x;
+        intrin.ppy -= rect.y;
+
+        auto cropped = vp.clone(vp.stream_type(), vp.stream_index(), vp.format(), rect.width, rect.height, intrin);
+        // Cropping moves the principal point, the camera stays where it is
+        cropped.register_extrinsics_to(profile, { { 1,0,0,0,1,0,0,0,1 },{ 0,0,0 } });
+
+        // Bounded for the pipelines resolving their profiles again and again, and for regions changing over time
+        if (_cropped_profiles.size() >= max_cropped_profiles)
+        {
+            _released_profiles += _cropped_profiles.size();
+            _cropped_profiles.clear();
+        }
+        else if (it != _cropped_profiles.end())
+            ++_released_profiles;
+        auto& entry = _cropped_profiles[key];
+        entry.source = source->shared_from_this();
+        entry.profile = cropped;
+        return cropped;
+    }
+
+    rs2::frame processing_roi::crop_frame(const rs2::frame_source& source, const rs2::frame& f, const pixel_rect& rect, rs2_extension frame_type)
+    {
+        auto vf = f.as<rs2::video_frame>();
+        auto bpp = vf.get_bytes_per_pixel();
+        auto tgt = source.allocate_video_frame(get_cropped_profile(f.get_profile(), rect), f, bpp,
+            rect.width, rect.height, rect.width * bpp, frame_type);
+        if (!tgt)
+            return tgt;
+
+        auto src = static_cast<const uint8_t*>(vf.get_data()) + rect.y * vf.get_stride_in_bytes() + rect.x * bpp;
+        copy_rows(const_cast<void*>(tgt.get_data()), rect.width * bpp, src, vf.get_stride_in_bytes(), rect.width * bpp, rect.height);
+        return tgt;
+    }
+
+    void* processing_roi::gather(void* image, int width, int height, size_t bpp, const pixel_rect& rect)
+    {
+        if (rect.width == width && rect.height == height)
+            return image;
+
+        _buffer.resize(rect.width * rect.height * bpp);
+        auto src = static_cast<const uint8_t*>(image) + (rect.y * width + rect.x) * bpp;
+        copy_rows(_buffer.data(), rect.width * bpp, src, width * bpp, rect.width * bpp, rect.height);
+        return _buffer.data();
+    }
+
+    void processing_roi::scatter(void* image, int width, int height, size_t bpp, const pixel_rect& rect)
+    {
+        if (rect.width == width && rect.height == height)
+            return;
+
+        auto dst = static_cast<uint8_t*>(image) + (rect.y * width + rect.x) * bpp;
+        copy_rows(dst, width * bpp, _buffer.data(), rect.width * bpp, rect.width * bpp, rect.height);
+    }
+
+    void copy_rows(void* dst, size_t dst_stride, const void* src, size_t src_stride, size_t row_bytes, size_t rows)
+    {
+        if (dst_stride == row_bytes && src_stride == row_bytes)
+        {
+            memmove(dst, src, row_bytes * rows);
+            return;
+        }
+
+        auto d = static_cast<uint8_t*>(dst);
+        auto s = static_cast<const uint8_t*>(src);
+        for (size_t i = 0; i < rows; ++i, d += dst_stride, s += src_stride)
+            memcpy(d, s, row_bytes);
+    }
+}
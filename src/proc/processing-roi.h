@@ -0,0 +1,92 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "core/options.h"
+#include "core/streaming.h"
+#include "../include/librealsense2/hpp/rs_frame.hpp"
+#include "../include/librealsense2/hpp/rs_processing.hpp"
+
+namespace librealsense
+{
+    // Rectangle of an image in pixels
+    struct pixel_rect
+    {
+        int x, y;
+        int width, height;
+    };
+
+    inline bool operator==(const pixel_rect& a, const pixel_rect& b)
+    {
+        return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+    }
+
+    // Region of interest of a processing block, the rectangle of its input frames it computes.
+    // It is set through the RS2_OPTION_ROI_MIN_X/Y and RS2_OPTION_ROI_MAX_X/Y options in coordinates normalized
+    // to the frame size, so that it keeps covering the same part of the scene whatever the resolution, each min
+    // bound staying below the matching max bound. Outside the region the output frame keeps the input data, or is
+    // empty for blocks producing other data, unless RS2_OPTION_ROI_CROP makes the output the region alone
+    class processing_roi
+    {
+    public:
+        // Registers the region of interest options of block, on_change is called with mutex held after every change
+        processing_roi(options_container& block, std::mutex& mutex, std::function<void()> on_change = [](){});
+
+        // Whether the region is smaller than the frame
+        bool is_set() const;
+        bool crop() const { return is_set() && _crop; }
+
+        // The region in a width x height frame, its corners moved outwards to multiples of align
+        // and at least two pixels wide and high. The whole frame when not set
+        pixel_rect get(int width, int height, int align = 1) const;
+
+        // Profile of the rect of profile, with the principal point shifted to it and the same extrinsics.
+        // A profile is reused for the frames of the same profile and rect
+        rs2::stream_profile get_cropped_profile(const rs2::stream_profile& profile, const pixel_rect& rect);
+
+        // Number of cropped profiles let go of so far. Blocks keeping state per cropped profile forget it when this changes,
+        // the address of a released profile may come back as another one
+        size_t released_profiles() const { return _released_profiles; }
+
+        // Copy of the rect of the video frame f, of the cropped profile
+        rs2::frame crop_frame(const rs2::frame_source& source, const rs2::frame& f, const pixel_rect& rect, rs2_extension frame_type);
+
+        // Contiguous copy of the rect of an image of the given width for the filters working on whole images,
+        // the image itself when the rect covers it. scatter writes the copy back to the image
+        void* gather(void* image, int width, int height, size_t bpp, const pixel_rect& rect);
+        void scatter(void* image, int width, int height, size_t bpp, const pixel_rect& rect);
+
+    private:
+        float _min_x, _min_y, _max_x, _max_y;
+        bool _crop;
+
+        // Keyed by what the cropped profile is made of rather than by the source profile, whose address may be reused.
+        // The entry holds the source it was made of, another source of the same stream gets its own cropped profile
+        struct cropped_profile_key
+        {
+            int unique_id;
+            rs2_format format;
+            int width, height;
+            pixel_rect rect;
+
+            bool operator<(const cropped_profile_key& other) const;
+        };
+        struct cropped_profile
+        {
+            std::weak_ptr<const stream_interface> source;
+            rs2::stream_profile profile;
+        };
+        std::map<cropped_profile_key, cropped_profile> _cropped_profiles;
+        size_t _released_profiles = 0;
+        std::vector<uint8_t> _buffer;
+    };
+
+    // Copies rows of row_bytes between images of the given strides
+    void copy_rows(void* dst, size_t dst_stride, const void* src, size_t src_stride, size_t row_bytes, size_t rows);
+}
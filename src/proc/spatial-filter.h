@@ -12,6 +12,7 @@
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include "proc/processing-roi.h"
 
 namespace librealsense
 {
@@ -22,6 +23,8 @@ namespace librealsense
 
     protected:
         void    update_configuration(const rs2::frame& f);
+        // Configure for frames of the given profile and type, f is the frame the data originates from
+        void    update_configuration(const rs2::frame& f, const rs2::stream_profile& profile, rs2_extension type);
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -264,12 +267,14 @@ namespace librealsense
         }
 
     private:
+        friend class depth_post_processing;
 
         float                   _spatial_alpha_param;
         uint8_t                 _spatial_delta_param;
         uint8_t                 _spatial_iterations;
         float                   _spatial_edge_threshold;
-        size_t                  _width, _height, _stride;
+        size_t                  _width, _height, _stride;   // Size of the region filtered, stride of the target frame
+        size_t                  _target_width, _target_height;
         size_t                  _bpp;
         rs2_extension           _extension_type;            // Strictly Depth/Disparity
         size_t                  _current_frm_size_pixels;
@@ -280,6 +285,8 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        processing_roi          _roi;
+        pixel_rect              _roi_rect;                  // Region of interest of the input frame
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
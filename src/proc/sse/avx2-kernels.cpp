@@ -0,0 +1,228 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "simd-kernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace librealsense
+{
+    bool avx2_kernels_available() { return true; }
+
+    // Local to this unit, the AVX-512 unit defines the same names for its wider registers
+    namespace
+    {
+        // 8 (x,y,z) triplets <-> 3 registers of x, y and z, using the same shuffles as the SSE kernels per 128-bit lane
+        // dst must be 32-byte aligned
+        inline void stream_xyz(float* dst, const __m256& x, const __m256& y, const __m256& z)
+        {
+            auto x_y = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+            auto z_x = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+            auto y_z = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+
+            auto xyz0 = _mm256_shuffle_ps(x_y, z_x, _MM_SHUFFLE(2, 0, 2, 0));
+            auto xyz1 = _mm256_shuffle_ps(y_z, x_y, _MM_SHUFFLE(3, 1, 2, 0));
+            auto xyz2 = _mm256_shuffle_ps(z_x, y_z, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm256_stream_ps(dst, _mm256_permute2f128_ps(xyz0, xyz1, 0x20));
+            _mm256_stream_ps(dst + 8, _mm256_permute2f128_ps(xyz2, xyz0, 0x30));
+            _mm256_stream_ps(dst + 16, _mm256_permute2f128_ps(xyz1, xyz2, 0x31));
+        }
+
+        inline void load_xyz(const float* src, __m256* x, __m256* y, __m256* z)
+        {
+            auto m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), _mm_loadu_ps(src + 12), 1);
+            auto m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)), _mm_loadu_ps(src + 16), 1);
+            auto m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)), _mm_loadu_ps(src + 20), 1);
+
+            auto yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+            auto xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+
+            *x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+            *y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            *z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+        }
+
+        inline void store_xy(float* dst, const __m256& x, const __m256& y)
+        {
+            auto lo = _mm256_unpacklo_ps(x, y);
+            auto hi = _mm256_unpackhi_ps(x, y);
+            _mm256_storeu_ps(dst, _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+        }
+
+        inline void store_xy(int* dst, const __m256i& x, const __m256i& y)
+        {
+            auto lo = _mm256_unpacklo_epi32(x, y);
+            auto hi = _mm256_unpackhi_epi32(x, y);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        inline __m256 load_depth(const uint16_t* depth, const __m256& scale)
+        {
+            auto d = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(depth)));
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(d), scale);
+        }
+
+        struct transform_coeffs
+        {
+            __m256 r[9], t[3];
+
+            explicit transform_coeffs(const rs2_extrinsics& extr)
+            {
+                for (int i = 0; i < 9; ++i) r[i] = _mm256_set1_ps(extr.rotation[i]);
+                for (int i = 0; i < 3; ++i) t[i] = _mm256_set1_ps(extr.translation[i]);
+            }
+
+            // Transform and divide by the resulting z
+            inline void apply(const __m256& x, const __m256& y, const __m256& z, __m256* u, __m256* v) const
+            {
+                auto p_x = _mm256_add_ps(_mm256_mul_ps(r[0], x), _mm256_add_ps(_mm256_mul_ps(r[3], y), _mm256_add_ps(_mm256_mul_ps(r[6], z), t[0])));
+                auto p_y = _mm256_add_ps(_mm256_mul_ps(r[1], x), _mm256_add_ps(_mm256_mul_ps(r[4], y), _mm256_add_ps(_mm256_mul_ps(r[7], z), t[1])));
+                auto p_z = _mm256_add_ps(_mm256_mul_ps(r[2], x), _mm256_add_ps(_mm256_mul_ps(r[5], y), _mm256_add_ps(_mm256_mul_ps(r[8], z), t[2])));
+                *u = _mm256_div_ps(p_x, p_z);
+                *v = _mm256_div_ps(p_y, p_z);
+            }
+        };
+
+        struct distortion_coeffs
+        {
+            __m256 c[5];
+
+            explicit distortion_coeffs(const rs2_intrinsics& to)
+            {
+                for (int i = 0; i < 5; ++i) c[i] = _mm256_set1_ps(to.coeffs[i]);
+            }
+
+            inline void apply(__m256* x, __m256* y) const
+            {
+                auto one = _mm256_set1_ps(1);
+                auto two = _mm256_set1_ps(2);
+
+                auto r2 = _mm256_add_ps(_mm256_mul_ps(*x, *x), _mm256_mul_ps(*y, *y));
+                auto r3 = _mm256_add_ps(_mm256_mul_ps(c[1], _mm256_mul_ps(r2, r2)), _mm256_mul_ps(c[4], _mm256_mul_ps(r2, _mm256_mul_ps(r2, r2))));
+                auto f = _mm256_add_ps(one, _mm256_add_ps(_mm256_mul_ps(c[0], r2), r3));
+
+                auto x_f = _mm256_mul_ps(*x, f);
+                auto y_f = _mm256_mul_ps(*y, f);
+
+                auto r4 = _mm256_mul_ps(c[3], _mm256_add_ps(r2, _mm256_mul_ps(two, _mm256_mul_ps(x_f, x_f))));
+                *x = _mm256_add_ps(x_f, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[2], _mm256_mul_ps(x_f, y_f))), r4));
+                *y = _mm256_add_ps(y_f, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[3], _mm256_mul_ps(x_f, y_f))), r4));
+            }
+        };
+    }
+
+    void deproject_points_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count)
+    {
+        auto scale = _mm256_set1_ps(depth_scale);
+
+        // The vertices are written once and not read back here, stream them past the cache
+        size_t i = points_alignment_offset(points, count, 32);
+        deproject_points_scalar(depth, depth_scale, map_x, map_y, points, i);
+        for (; i + 8 <= count; i += 8)
+        {
+            auto z = load_depth(depth + i, scale);
+            auto x = _mm256_mul_ps(z, _mm256_loadu_ps(map_x + i));
+            auto y = _mm256_mul_ps(z, _mm256_loadu_ps(map_y + i));
+            stream_xyz(points + i * 3, x, y, z);
+        }
+        _mm_sfence();
+        deproject_points_scalar(depth + i, depth_scale, map_x + i, map_y + i, points + i * 3, count - i);
+    }
+
+    void project_points_avx2(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        transform_coeffs transform(extr);
+        distortion_coeffs distortion(to);
+        bool distort = to.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY;
+
+        auto fx = _mm256_set1_ps(to.fx);
+        auto fy = _mm256_set1_ps(to.fy);
+        auto ppx = _mm256_set1_ps(to.ppx);
+        auto ppy = _mm256_set1_ps(to.ppy);
+        auto w = _mm256_set1_ps((float)to.width);
+        auto h = _mm256_set1_ps((float)to.height);
+        auto zero = _mm256_setzero_ps();
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x, y, z, p_x, p_y;
+            load_xyz(points + i * 3, &x, &y, &z);
+            transform.apply(x, y, z, &p_x, &p_y);
+            if (distort)
+                distortion.apply(&p_x, &p_y);
+
+            //zero the x and y if z is zero
+            auto valid = _mm256_cmp_ps(z, zero, _CMP_NEQ_UQ);
+            p_x = _mm256_and_ps(_mm256_add_ps(_mm256_mul_ps(p_x, fx), ppx), valid);
+            p_y = _mm256_and_ps(_mm256_add_ps(_mm256_mul_ps(p_y, fy), ppy), valid);
+            store_xy(pixels + i * 2, p_x, p_y);
+
+            store_xy(tex + i * 2, _mm256_div_ps(p_x, w), _mm256_div_ps(p_y, h));
+        }
+        project_points_scalar(points + i * 3, count - i, to, extr, pixels + i * 2, tex + i * 2);
+    }
+
+    void map_depth_pixels_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+    {
+        transform_coeffs transform(extr);
+        distortion_coeffs distortion(to);
+
+        auto scale = _mm256_set1_ps(depth_scale);
+        auto fx = _mm256_set1_ps(to.fx);
+        auto fy = _mm256_set1_ps(to.fy);
+        auto ppx = _mm256_set1_ps(to.ppx);
+        auto ppy = _mm256_set1_ps(to.ppy);
+        auto half = _mm256_set1_ps(0.5f);
+        auto zero = _mm256_setzero_ps();
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            auto z = load_depth(depth + i, scale);
+            auto x = _mm256_mul_ps(z, _mm256_loadu_ps(map_x + i));
+            auto y = _mm256_mul_ps(z, _mm256_loadu_ps(map_y + i));
+
+            __m256 p_x, p_y;
+            transform.apply(x, y, z, &p_x, &p_y);
+            if (distort)
+                distortion.apply(&p_x, &p_y);
+
+            auto valid = _mm256_cmp_ps(z, zero, _CMP_NEQ_UQ);
+            auto u = _mm256_and_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p_x, fx), ppx), half), valid);
+            auto v = _mm256_and_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p_y, fy), ppy), half), valid);
+            store_xy(pixels + i * 2, _mm256_cvtps_epi32(u), _mm256_cvtps_epi32(v));
+        }
+        map_depth_pixels_scalar(depth + i, depth_scale, map_x + i, map_y + i, count - i, to, extr, distort, pixels + i * 2);
+    }
+}
+
+#else // __AVX2__
+
+namespace librealsense
+{
+    bool avx2_kernels_available() { return false; }
+
+    void deproject_points_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count)
+    {
+        deproject_points_scalar(depth, depth_scale, map_x, map_y, points, count);
+    }
+
+    void project_points_avx2(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        project_points_scalar(points, count, to, extr, pixels, tex);
+    }
+
+    void map_depth_pixels_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+    {
+        map_depth_pixels_scalar(depth, depth_scale, map_x, map_y, count, to, extr, distort, pixels);
+    }
+}
+
+#endif // __AVX2__
@@ -0,0 +1,248 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "simd-kernels.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+
+namespace librealsense
+{
+    bool avx512_kernels_available() { return true; }
+
+    // Local to this unit, the AVX2 unit defines the same names for its narrower registers
+    namespace
+    {
+        // Permutation tables converting between 16 (x,y,z) triplets and registers of x, y and z.
+        // Each output register is first assembled from two sources with permutex2var, the
+        // remaining lanes (given by the mask) are then taken from the third source
+        const int32_t store_xyz_xy_idx[3][16] = {
+            { 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5 },
+            { 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26 },
+            { 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0 } };
+        const int32_t store_xyz_z_idx[3][16] = {
+            { 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 3, 0, 0, 4, 0 },
+            { 0, 5, 0, 0, 6, 0, 0, 7, 0, 0, 8, 0, 0, 9, 0, 0 },
+            { 10, 0, 0, 11, 0, 0, 12, 0, 0, 13, 0, 0, 14, 0, 0, 15 } };
+        const __mmask16 store_xyz_z_mask[3] = { 0x4924, 0x2492, 0x9249 };
+
+        const int32_t load_xyz_lo_idx[3][16] = {
+            { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0 },
+            { 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0 },
+            { 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0 } };
+        const int32_t load_xyz_hi_idx[3][16] = {
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 7, 10, 13 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 5, 8, 11, 14 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 6, 9, 12, 15 } };
+        const __mmask16 load_xyz_hi_mask[3] = { 0xf800, 0xf800, 0xfc00 };
+
+        const int32_t store_xy_idx[2][16] = {
+            { 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23 },
+            { 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31 } };
+
+        inline __m512i load_idx(const int32_t* idx)
+        {
+            return _mm512_loadu_si512(idx);
+        }
+
+        // dst must be 64-byte aligned
+        inline void stream_xyz(float* dst, const __m512& x, const __m512& y, const __m512& z)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                auto xy = _mm512_permutex2var_ps(x, load_idx(store_xyz_xy_idx[i]), y);
+                _mm512_stream_ps(dst + i * 16, _mm512_mask_permutexvar_ps(xy, store_xyz_z_mask[i], load_idx(store_xyz_z_idx[i]), z));
+            }
+        }
+
+        inline void load_xyz(const float* src, __m512* x, __m512* y, __m512* z)
+        {
+            auto v0 = _mm512_loadu_ps(src);
+            auto v1 = _mm512_loadu_ps(src + 16);
+            auto v2 = _mm512_loadu_ps(src + 32);
+            __m512* out[3] = { x, y, z };
+            for (int i = 0; i < 3; ++i)
+            {
+                auto lo = _mm512_permutex2var_ps(v0, load_idx(load_xyz_lo_idx[i]), v1);
+                *out[i] = _mm512_mask_permutexvar_ps(lo, load_xyz_hi_mask[i], load_idx(load_xyz_hi_idx[i]), v2);
+            }
+        }
+
+        inline void store_xy(float* dst, const __m512& x, const __m512& y)
+        {
+            _mm512_storeu_ps(dst, _mm512_permutex2var_ps(x, load_idx(store_xy_idx[0]), y));
+            _mm512_storeu_ps(dst + 16, _mm512_permutex2var_ps(x, load_idx(store_xy_idx[1]), y));
+        }
+
+        inline void store_xy(int* dst, const __m512i& x, const __m512i& y)
+        {
+            _mm512_storeu_si512(dst, _mm512_permutex2var_epi32(x, load_idx(store_xy_idx[0]), y));
+            _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi32(x, load_idx(store_xy_idx[1]), y));
+        }
+
+        inline __m512 load_depth(const uint16_t* depth, const __m512& scale)
+        {
+            auto d = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(depth)));
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(d), scale);
+        }
+
+        struct transform_coeffs
+        {
+            __m512 r[9], t[3];
+
+            explicit transform_coeffs(const rs2_extrinsics& extr)
+            {
+                for (int i = 0; i < 9; ++i) r[i] = _mm512_set1_ps(extr.rotation[i]);
+                for (int i = 0; i < 3; ++i) t[i] = _mm512_set1_ps(extr.translation[i]);
+            }
+
+            // Transform and divide by the resulting z
+            inline void apply(const __m512& x, const __m512& y, const __m512& z, __m512* u, __m512* v) const
+            {
+                auto p_x = _mm512_add_ps(_mm512_mul_ps(r[0], x), _mm512_add_ps(_mm512_mul_ps(r[3], y), _mm512_add_ps(_mm512_mul_ps(r[6], z), t[0])));
+                auto p_y = _mm512_add_ps(_mm512_mul_ps(r[1], x), _mm512_add_ps(_mm512_mul_ps(r[4], y), _mm512_add_ps(_mm512_mul_ps(r[7], z), t[1])));
+                auto p_z = _mm512_add_ps(_mm512_mul_ps(r[2], x), _mm512_add_ps(_mm512_mul_ps(r[5], y), _mm512_add_ps(_mm512_mul_ps(r[8], z), t[2])));
+                *u = _mm512_div_ps(p_x, p_z);
+                *v = _mm512_div_ps(p_y, p_z);
+            }
+        };
+
+        struct distortion_coeffs
+        {
+            __m512 c[5];
+
+            explicit distortion_coeffs(const rs2_intrinsics& to)
+            {
+                for (int i = 0; i < 5; ++i) c[i] = _mm512_set1_ps(to.coeffs[i]);
+            }
+
+            inline void apply(__m512* x, __m512* y) const
+            {
+                auto one = _mm512_set1_ps(1);
+                auto two = _mm512_set1_ps(2);
+
+                auto r2 = _mm512_add_ps(_mm512_mul_ps(*x, *x), _mm512_mul_ps(*y, *y));
+                auto r3 = _mm512_add_ps(_mm512_mul_ps(c[1], _mm512_mul_ps(r2, r2)), _mm512_mul_ps(c[4], _mm512_mul_ps(r2, _mm512_mul_ps(r2, r2))));
+                auto f = _mm512_add_ps(one, _mm512_add_ps(_mm512_mul_ps(c[0], r2), r3));
+
+                auto x_f = _mm512_mul_ps(*x, f);
+                auto y_f = _mm512_mul_ps(*y, f);
+
+                auto r4 = _mm512_mul_ps(c[3], _mm512_add_ps(r2, _mm512_mul_ps(two, _mm512_mul_ps(x_f, x_f))));
+                *x = _mm512_add_ps(x_f, _mm512_add_ps(_mm512_mul_ps(two, _mm512_mul_ps(c[2], _mm512_mul_ps(x_f, y_f))), r4));
+                *y = _mm512_add_ps(y_f, _mm512_add_ps(_mm512_mul_ps(two, _mm512_mul_ps(c[3], _mm512_mul_ps(x_f, y_f))), r4));
+            }
+        };
+    }
+
+    void deproject_points_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count)
+    {
+        auto scale = _mm512_set1_ps(depth_scale);
+
+        // The vertices are written once and not read back here, stream them past the cache
+        size_t i = points_alignment_offset(points, count, 64);
+        deproject_points_scalar(depth, depth_scale, map_x, map_y, points, i);
+        for (; i + 16 <= count; i += 16)
+        {
+            auto z = load_depth(depth + i, scale);
+            auto x = _mm512_mul_ps(z, _mm512_loadu_ps(map_x + i));
+            auto y = _mm512_mul_ps(z, _mm512_loadu_ps(map_y + i));
+            stream_xyz(points + i * 3, x, y, z);
+        }
+        _mm_sfence();
+        deproject_points_scalar(depth + i, depth_scale, map_x + i, map_y + i, points + i * 3, count - i);
+    }
+
+    void project_points_avx512(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        transform_coeffs transform(extr);
+        distortion_coeffs distortion(to);
+        bool distort = to.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY;
+
+        auto fx = _mm512_set1_ps(to.fx);
+        auto fy = _mm512_set1_ps(to.fy);
+        auto ppx = _mm512_set1_ps(to.ppx);
+        auto ppy = _mm512_set1_ps(to.ppy);
+        auto w = _mm512_set1_ps((float)to.width);
+        auto h = _mm512_set1_ps((float)to.height);
+        auto zero = _mm512_setzero_ps();
+
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512 x, y, z, p_x, p_y;
+            load_xyz(points + i * 3, &x, &y, &z);
+            transform.apply(x, y, z, &p_x, &p_y);
+            if (distort)
+                distortion.apply(&p_x, &p_y);
+
+            //zero the x and y if z is zero
+            auto valid = _mm512_cmp_ps_mask(z, zero, _CMP_NEQ_UQ);
+            p_x = _mm512_maskz_mov_ps(valid, _mm512_add_ps(_mm512_mul_ps(p_x, fx), ppx));
+            p_y = _mm512_maskz_mov_ps(valid, _mm512_add_ps(_mm512_mul_ps(p_y, fy), ppy));
+            store_xy(pixels + i * 2, p_x, p_y);
+
+            store_xy(tex + i * 2, _mm512_div_ps(p_x, w), _mm512_div_ps(p_y, h));
+        }
+        project_points_scalar(points + i * 3, count - i, to, extr, pixels + i * 2, tex + i * 2);
+    }
+
+    void map_depth_pixels_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+    {
+        transform_coeffs transform(extr);
+        distortion_coeffs distortion(to);
+
+        auto scale = _mm512_set1_ps(depth_scale);
+        auto fx = _mm512_set1_ps(to.fx);
+        auto fy = _mm512_set1_ps(to.fy);
+        auto ppx = _mm512_set1_ps(to.ppx);
+        auto ppy = _mm512_set1_ps(to.ppy);
+        auto half = _mm512_set1_ps(0.5f);
+        auto zero = _mm512_setzero_ps();
+
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            auto z = load_depth(depth + i, scale);
+            auto x = _mm512_mul_ps(z, _mm512_loadu_ps(map_x + i));
+            auto y = _mm512_mul_ps(z, _mm512_loadu_ps(map_y + i));
+
+            __m512 p_x, p_y;
+            transform.apply(x, y, z, &p_x, &p_y);
+            if (distort)
+                distortion.apply(&p_x, &p_y);
+
+            auto valid = _mm512_cmp_ps_mask(z, zero, _CMP_NEQ_UQ);
+            auto u = _mm512_maskz_mov_ps(valid, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(p_x, fx), ppx), half));
+            auto v = _mm512_maskz_mov_ps(valid, _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(p_y, fy), ppy), half));
+            store_xy(pixels + i * 2, _mm512_cvtps_epi32(u), _mm512_cvtps_epi32(v));
+        }
+        map_depth_pixels_scalar(depth + i, depth_scale, map_x + i, map_y + i, count - i, to, extr, distort, pixels + i * 2);
+    }
+}
+
+#else // __AVX512F__
+
+namespace librealsense
+{
+    bool avx512_kernels_available() { return false; }
+
+    void deproject_points_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count)
+    {
+        deproject_points_scalar(depth, depth_scale, map_x, map_y, points, count);
+    }
+
+    void project_points_avx512(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        project_points_scalar(points, count, to, extr, pixels, tex);
+    }
+
+    void map_depth_pixels_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+    {
+        map_depth_pixels_scalar(depth, depth_scale, map_x, map_y, count, to, extr, distort, pixels);
+    }
+}
+
+#endif // __AVX512F__
@@ -0,0 +1,188 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cmath>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include "../include/librealsense2/h/rs_sensor.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Wide variants of the SSE deprojection / projection kernels used by pointcloud_sse and align_sse.
+// The AVX2 and AVX-512 translation units are compiled with their own target flags, the kernel
+// set is picked once at runtime according to what both the build and the CPU support.
+namespace librealsense
+{
+    enum class simd_level
+    {
+        sse,
+        avx2,
+        avx512
+    };
+
+    // Kernels available in this build (false when the compiler was not given the target flags)
+    bool avx2_kernels_available();
+    bool avx512_kernels_available();
+
+    inline bool cpu_supports(simd_level level)
+    {
+        if (level == simd_level::sse) return true;
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+        __cpuid(info, 1);
+        bool os_saves_ymm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+        if (!os_saves_ymm) return false;
+        __cpuidex(info, 7, 0);
+        if (level == simd_level::avx2) return (info[1] & (1 << 5)) != 0;
+        return (info[1] & (1 << 16)) && ((_xgetbv(0) & 0xe6) == 0xe6);
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        if (level == simd_level::avx2) return __builtin_cpu_supports("avx2") != 0;
+        return __builtin_cpu_supports("avx512f") != 0;
+#else
+        return false;
+#endif
+    }
+
+    // Widest kernel set usable on this machine, resolved once per process
+    inline simd_level get_simd_level()
+    {
+        static const simd_level level = []()
+        {
+            if (avx512_kernels_available() && cpu_supports(simd_level::avx512)) return simd_level::avx512;
+            if (avx2_kernels_available() && cpu_supports(simd_level::avx2)) return simd_level::avx2;
+            return simd_level::sse;
+        }();
+        return level;
+    }
+
+    // points[3*i..3*i+2] = depth[i] * depth_scale * (map_x[i], map_y[i], 1)
+    void deproject_points_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count);
+    void deproject_points_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count);
+
+    // Transform points to the other stream and project them, writing pixel coordinates and
+    // normalized texture coordinates. Points with zero depth map to (0,0).
+    // The distortion term is applied for RS2_DISTORTION_INVERSE_BROWN_CONRADY, as in pointcloud_sse
+    void project_points_avx2(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex);
+    void project_points_avx512(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex);
+
+    // Deproject depth pixels, transform and project them onto the other stream, writing rounded
+    // integer (x,y) pairs. Pixels with zero depth map to (0,0). As in align_sse, the distortion
+    // term is applied only when distort is set
+    void map_depth_pixels_avx2(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels);
+    void map_depth_pixels_avx512(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels);
+
+    // Scalar equivalents used for the tails of the wide kernels. The operation order mirrors the
+    // SSE kernels so that every kernel width produces the same values.
+    // They are local to every translation unit: the AVX units are compiled with their target flags,
+    // a copy shared between the units could end up with wide instructions in the SSE callers
+    static inline void distort_point(float& x, float& y, const float* c)
+    {
+        auto r2 = x * x + y * y;
+        auto r3 = c[1] * (r2 * r2) + c[4] * (r2 * (r2 * r2));
+        auto f = 1 + (c[0] * r2 + r3);
+        auto x_f = x * f;
+        auto y_f = y * f;
+        auto r4 = c[3] * (r2 + 2 * (x_f * x_f));
+        x = x_f + (2 * (c[2] * (x_f * y_f)) + r4);
+        y = y_f + (2 * (c[3] * (x_f * y_f)) + r4);
+    }
+
+    static inline void transform_point(float& x, float& y, float& z, const rs2_extrinsics& extr)
+    {
+        auto& r = extr.rotation;
+        auto& t = extr.translation;
+        auto p_x = r[0] * x + (r[3] * y + (r[6] * z + t[0]));
+        auto p_y = r[1] * x + (r[4] * y + (r[7] * z + t[1]));
+        auto p_z = r[2] * x + (r[5] * y + (r[8] * z + t[2]));
+        x = p_x; y = p_y; z = p_z;
+    }
+
+    // Same conversion as _mm_cvtps_epi32 under the default rounding mode
+    static inline int round_to_int(float v)
+    {
+        if (!(v > (float)INT_MIN && v < (float)INT_MAX)) return INT_MIN;
+        return static_cast<int>(std::nearbyint(v));
+    }
+
+    // Number of leading points to deproject before points + 3 * n sits on an alignment boundary,
+    // so the wide kernels can use non-temporal stores like the SSE kernel does. Returns count
+    // when the boundary cannot be reached
+    static inline size_t points_alignment_offset(const float* points, size_t count, size_t alignment)
+    {
+        auto address = reinterpret_cast<uintptr_t>(points);
+        if (address % sizeof(float)) return count;
+        for (size_t n = 0; n < count && n < alignment; ++n)
+            if ((address + n * 3 * sizeof(float)) % alignment == 0) return n;
+        return count;
+    }
+
+    static inline void deproject_points_scalar(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto z = depth[i] * depth_scale;
+            points[i * 3 + 0] = z * map_x[i];
+            points[i * 3 + 1] = z * map_y[i];
+            points[i * 3 + 2] = z;
+        }
+    }
+
+    static inline void project_points_scalar(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            float x = points[i * 3], y = points[i * 3 + 1], z = points[i * 3 + 2];
+            auto depth = z;
+            transform_point(x, y, z, extr);
+            x = x / z;
+            y = y / z;
+            if (to.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
+                distort_point(x, y, to.coeffs);
+            if (depth != 0)
+            {
+                x = x * to.fx + to.ppx;
+                y = y * to.fy + to.ppy;
+            }
+            else
+            {
+                x = y = 0.f;
+            }
+            pixels[i * 2] = x;
+            pixels[i * 2 + 1] = y;
+            tex[i * 2] = x / to.width;
+            tex[i * 2 + 1] = y / to.height;
+        }
+    }
+
+    static inline void map_depth_pixels_scalar(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto z = depth[i] * depth_scale;
+            if (z == 0)
+            {
+                pixels[i * 2] = pixels[i * 2 + 1] = 0;
+                continue;
+            }
+            float x = z * map_x[i], y = z * map_y[i];
+            transform_point(x, y, z, extr);
+            x = x / z;
+            y = y / z;
+            if (distort)
+                distort_point(x, y, to.coeffs);
+            pixels[i * 2] = round_to_int(x * to.fx + to.ppx + 0.5f);
+            pixels[i * 2 + 1] = round_to_int(y * to.fy + to.ppy + 0.5f);
+        }
+    }
+}
@@ -194,9 +194,19 @@ inline void get_texture_map_sse(const uint16_t * depth,
     }
 }
 
+void librealsense::map_depth_pixels_sse(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+    const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels)
+{
+    if (distort)
+        get_texture_map_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(depth, depth_scale, (unsigned int)count, map_x, map_y, (byte*)pixels, to, extr);
+    else
+        get_texture_map_sse<RS2_DISTORTION_NONE>(depth, depth_scale, (unsigned int)count, map_x, map_y, (byte*)pixels, to, extr);
+}
+
 image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
     :_depth(from),
     _depth_scale(depth_scale),
+    _simd_level(get_simd_level()),
     _pixel_top_left_int(from.width*from.height),
     _pixel_bottom_right_int(from.width*from.height)
 {
@@ -204,40 +214,9 @@ image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
 
 void image_transform::pre_compute_x_y_map_corners()
 {
-    pre_compute_x_y_map(_pre_compute_map_x_top_left, _pre_compute_map_y_top_left, -0.5f);
-    pre_compute_x_y_map(_pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right, 0.5f);
-}
-
-void image_transform::pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
-    std::vector<float>& pre_compute_map_y,
-    float offset)
-{
-    pre_compute_map_x.resize(_depth.width*_depth.height);
-    pre_compute_map_y.resize(_depth.width*_depth.height);
-
-    for (int h = 0; h < _depth.height; ++h)
-    {
-        for (int w = 0; w < _depth.width; ++w)
-        {
-            const float pixel[] = { (float)w + offset, (float)h + offset };
-
-            float x = (pixel[0] - _depth.ppx) / _depth.fx;
-            float y = (pixel[1] - _depth.ppy) / _depth.fy;
-
-            if (_depth.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-            {
-                float r2 = x * x + y * y;
-                float f = 1 + _depth.coeffs[0] * r2 + _depth.coeffs[1] * r2*r2 + _depth.coeffs[4] * r2*r2*r2;
-                float ux = x * f + 2 * _depth.coeffs[2] * x*y + _depth.coeffs[3] * (r2 + 2 * x*x);
-                float uy = y * f + 2 * _depth.coeffs[3] * x*y + _depth.coeffs[2] * (r2 + 2 * y*y);
-                x = ux;
-                y = uy;
-            }
-
-            pre_compute_map_x[h*_depth.width + w] = x;
-            pre_compute_map_y[h*_depth.width + w] = y;
-        }
-    }
+    auto& cache = deprojection_map_cache::get_instance();
+    _pre_compute_map_top_left = cache.get(_depth, -0.5f);
+    _pre_compute_map_bottom_right = cache.get(_depth, 0.5f);
 }
 
 void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, int bpp, const rs2_intrinsics& depth, const rs2_intrinsics& to,
@@ -298,12 +277,34 @@ void image_transform::align_other_to_depth(const uint16_t* z_pixels, const byte*
 }
 
 
+template<rs2_distortion dist>
+inline void image_transform::get_texture_map(const uint16_t* z_pixels, const deprojection_map& pre_compute_map,
+    std::vector<int2>& pixels, const rs2_intrinsics& to,
+    const rs2_extrinsics& from_to_other)
+{
+    auto size = _depth.height*_depth.width;
+    auto distort = dist == RS2_DISTORTION_MODIFIED_BROWN_CONRADY;
+    auto out = reinterpret_cast<int*>(pixels.data());
+
+    switch (_simd_level)
+    {
+    case simd_level::avx512:
+        map_depth_pixels_avx512(z_pixels, _depth_scale, pre_compute_map.x.data(), pre_compute_map.y.data(), size, to, from_to_other, distort, out);
+        break;
+    case simd_level::avx2:
+        map_depth_pixels_avx2(z_pixels, _depth_scale, pre_compute_map.x.data(), pre_compute_map.y.data(), size, to, from_to_other, distort, out);
+        break;
+    default:
+        map_depth_pixels_sse(z_pixels, _depth_scale, pre_compute_map.x.data(), pre_compute_map.y.data(), size, to, from_to_other, distort, out);
+        break;
+    }
+}
+
 template<rs2_distortion dist>
 inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (byte*)_pixel_top_left_int.data(), to, from_to_other);
+    get_texture_map<dist>(z_pixels, *_pre_compute_map_top_left, _pixel_top_left_int, to, from_to_other);
 
     float fov[2];
     rs2_fov(&depth, fov);
@@ -314,8 +315,7 @@ inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels,
 
     if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (byte*)_pixel_bottom_right_int.data(), to, from_to_other);
+        get_texture_map<dist>(z_pixels, *_pre_compute_map_bottom_right, _pixel_bottom_right_int, to, from_to_other);
 
         move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
     }
@@ -330,14 +330,12 @@ template<rs2_distortion dist>
 inline void image_transform::align_other_to_depth_sse(const uint16_t * z_pixels, const byte * source, byte * dest, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (byte*)_pixel_top_left_int.data(), to, from_to_other);
+    get_texture_map<dist>(z_pixels, *_pre_compute_map_top_left, _pixel_top_left_int, to, from_to_other);
 
     std::vector<int2>& bottom_right = _pixel_top_left_int;
     if (to.height < _depth.height && to.width < _depth.width)
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (byte*)_pixel_bottom_right_int.data(), to, from_to_other);
+        get_texture_map<dist>(z_pixels, *_pre_compute_map_bottom_right, _pixel_bottom_right_int, to, from_to_other);
 
         bottom_right = _pixel_bottom_right_int;
     }
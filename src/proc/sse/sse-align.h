@@ -4,9 +4,15 @@
 #ifdef __SSSE3__
 
 #include "proc/align.h"
+#include "simd-kernels.h"
+#include "proc/deprojection-map-cache.h"
 
 namespace librealsense
 {
+    // 128-bit kernel, the reference the AVX2 / AVX-512 kernels are dispatched from
+    void map_depth_pixels_sse(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        const rs2_intrinsics& to, const rs2_extrinsics& extr, bool distort, int* pixels);
+
     class image_transform
     {
     public:
@@ -31,18 +37,20 @@ namespace librealsense
 
         const rs2_intrinsics _depth;
         float _depth_scale;
+        simd_level _simd_level;
 
-        std::vector<float> _pre_compute_map_x_top_left;
-        std::vector<float> _pre_compute_map_y_top_left;
-        std::vector<float> _pre_compute_map_x_bottom_right;
-        std::vector<float> _pre_compute_map_y_bottom_right;
+        std::shared_ptr<const deprojection_map> _pre_compute_map_top_left;
+        std::shared_ptr<const deprojection_map> _pre_compute_map_bottom_right;
 
         std::vector<int2> _pixel_top_left_int;
         std::vector<int2> _pixel_bottom_right_int;
 
-        void pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
-            std::vector<float>& pre_compute_map_y,
-            float offset = 0);
+        // Project the depth pixels with the widest kernel available on this machine
+        template<rs2_distortion dist>
+        inline void get_texture_map(const uint16_t* z_pixels,
+            const deprojection_map& pre_compute_map,
+            std::vector<int2>& pixels, const rs2_intrinsics& to,
+            const rs2_extrinsics& from_to_other);
 
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
         inline void align_depth_to_other_sse(const uint16_t* z_pixels,
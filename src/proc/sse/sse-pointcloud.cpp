@@ -7,6 +7,7 @@
 #include "proc/synthetic-stream.h"
 #include "environment.h"
 #include "proc/occlusion-filter.h"
+#include "proc/deprojection-map-cache.h"
 #include "proc/sse/sse-pointcloud.h"
 #include "option.h"
 #include "environment.h"
@@ -20,57 +21,20 @@
 
 #endif
 
+#include <cstring>
+
 namespace librealsense
 {
-    pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)") {}
+    pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)"), _simd_level(get_simd_level()) {}
 
     void pointcloud_sse::preprocess()
     {
-        _pre_compute_map_x.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-        _pre_compute_map_y.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-
-        for (int h = 0; h < _depth_intrinsics->height; ++h)
-        {
-            for (int w = 0; w < _depth_intrinsics->width; ++w)
-            {
-                const float pixel[] = { (float)w, (float)h };
-
-                float x = (pixel[0] - _depth_intrinsics->ppx) / _depth_intrinsics->fx;
-                float y = (pixel[1] - _depth_intrinsics->ppy) / _depth_intrinsics->fy;
-
-
-                if (_depth_intrinsics->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-                {
-                    float r2 = x * x + y * y;
-                    float f = 1 + _depth_intrinsics->coeffs[0] * r2 + _depth_intrinsics->coeffs[1] * r2*r2 + _depth_intrinsics->coeffs[4] * r2*r2*r2;
-                    float ux = x * f + 2 * _depth_intrinsics->coeffs[2] * x*y + _depth_intrinsics->coeffs[3] * (r2 + 2 * x*x);
-                    float uy = y * f + 2 * _depth_intrinsics->coeffs[3] * x*y + _depth_intrinsics->coeffs[2] * (r2 + 2 * y*y);
-                    x = ux;
-                    y = uy;
-                }
-
-                _pre_compute_map_x[h*_depth_intrinsics->width + w] = x;
-                _pre_compute_map_y[h*_depth_intrinsics->width + w] = y;
-            }
-        }
+        _pre_compute_map = deprojection_map_cache::get_instance().get(*_depth_intrinsics);
     }
 
-    const float3* pointcloud_sse::depth_to_points(rs2::points output,
-            const rs2_intrinsics &depth_intrinsics, 
-            const rs2::depth_frame& depth_frame,
-            float depth_scale)
-    {
 #ifdef __SSSE3__
-
-        auto depth_image = (const uint16_t*)depth_frame.get_data();
-
-        float* pre_compute_x = _pre_compute_map_x.data();
-        float* pre_compute_y = _pre_compute_map_y.data();
-
-        uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
-
-        auto point = (float*)output.get_vertices();
-
+    void deproject_points_sse(const uint16_t* depth_image, float depth_scale, const float* pre_compute_x, const float* pre_compute_y, float* point, size_t size)
+    {
         //mask for shuffle
         const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
             (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
@@ -135,24 +99,47 @@ namespace librealsense
             _mm_stream_ps(&point[20], xyz13);
             point += 24;
         }
-#endif
-        return (float3*)output.get_vertices();
     }
+#endif
 
-    void pointcloud_sse::get_texture_map(rs2::points output,
-        const float3* points,
-        const unsigned int width,
-        const unsigned int height,
-        const rs2_intrinsics &other_intrinsics,
-        const rs2_extrinsics& extr,
-        float2* pixels_ptr)
+    const float3* pointcloud_sse::depth_to_points(rs2::points output,
+            const rs2_intrinsics &depth_intrinsics, 
+            const rs2::depth_frame& depth_frame,
+            float depth_scale)
     {
-        auto tex_ptr = (float2*)output.get_texture_coordinates();
+#ifdef __SSSE3__
+
+        auto depth_image = (const uint16_t*)depth_frame.get_data();
+
+        const float* pre_compute_x = _pre_compute_map->x.data();
+        const float* pre_compute_y = _pre_compute_map->y.data();
+
+        uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
+
+        auto point = (float*)output.get_vertices();
+
+        switch (_simd_level)
+        {
+        case simd_level::avx512:
+            deproject_points_avx512(depth_image, depth_scale, pre_compute_x, pre_compute_y, point, size);
+            break;
+        case simd_level::avx2:
+            deproject_points_avx2(depth_image, depth_scale, pre_compute_x, pre_compute_y, point, size);
+            break;
+        default:
+            deproject_points_sse(depth_image, depth_scale, pre_compute_x, pre_compute_y, point, size);
+            break;
+        }
+#endif
+        return (float3*)output.get_vertices();
+    }
 
 #ifdef __SSSE3__
-        auto point = reinterpret_cast<const float*>(points);
-        auto res = reinterpret_cast<float*>(tex_ptr);
-        auto res1 = reinterpret_cast<float*>(pixels_ptr);
+    void project_points_sse(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex)
+    {
+        auto point = points;
+        auto res = tex;
+        auto res1 = pixels;
 
         __m128 r[9];
         __m128 t[3];
@@ -168,21 +155,21 @@ namespace librealsense
         }
         for (int i = 0; i < 5; ++i)
         {
-            c[i] = _mm_set_ps1(other_intrinsics.coeffs[i]);
+            c[i] = _mm_set_ps1(to.coeffs[i]);
         }
 
-        auto fx = _mm_set_ps1(other_intrinsics.fx);
-        auto fy = _mm_set_ps1(other_intrinsics.fy);
-        auto ppx = _mm_set_ps1(other_intrinsics.ppx);
-        auto ppy = _mm_set_ps1(other_intrinsics.ppy);
-        auto w = _mm_set_ps1(other_intrinsics.width);
-        auto h = _mm_set_ps1(other_intrinsics.height);
+        auto fx = _mm_set_ps1(to.fx);
+        auto fy = _mm_set_ps1(to.fy);
+        auto ppx = _mm_set_ps1(to.ppx);
+        auto ppy = _mm_set_ps1(to.ppy);
+        auto w = _mm_set_ps1(to.width);
+        auto h = _mm_set_ps1(to.height);
         auto mask_inv_brown_conrady = _mm_set_ps1(RS2_DISTORTION_INVERSE_BROWN_CONRADY);
         auto zero = _mm_set_ps1(0);
         auto one = _mm_set_ps1(1);
         auto two = _mm_set_ps1(2);
 
-        for (auto i = 0UL; i < height*width * 3; i += 12)
+        for (auto i = 0UL; i < count * 3; i += 12)
         {
             //load 4 points (x,y,z)
             auto xyz1 = _mm_load_ps(point + i);
@@ -206,7 +193,7 @@ namespace librealsense
             p_y = _mm_div_ps(p_y, p_z);
 
             // if(model == RS2_DISTORTION_MODIFIED_BROWN_CONRADY)
-            auto dist = _mm_set_ps1(other_intrinsics.model);
+            auto dist = _mm_set_ps1(to.model);
 
             auto r2 = _mm_add_ps(_mm_mul_ps(p_x, p_x), _mm_mul_ps(p_y, p_y));
             auto r3 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2, r2)), _mm_mul_ps(c[4], _mm_mul_ps(r2, _mm_mul_ps(r2, r2))));
@@ -259,7 +246,257 @@ namespace librealsense
             _mm_stream_ps(res + 4, xyxy2);
             res += 8;
         }
+    }
 #endif
 
+    void pointcloud_sse::get_texture_map(rs2::points output,
+        const float3* points,
+        const unsigned int width,
+        const unsigned int height,
+        const rs2_intrinsics &other_intrinsics,
+        const rs2_extrinsics& extr,
+        float2* pixels_ptr)
+    {
+        auto tex_ptr = (float2*)output.get_texture_coordinates();
+
+#ifdef __SSSE3__
+        auto point = reinterpret_cast<const float*>(points);
+        auto res = reinterpret_cast<float*>(tex_ptr);
+        auto res1 = reinterpret_cast<float*>(pixels_ptr);
+
+        switch (_simd_level)
+        {
+        case simd_level::avx512:
+            project_points_avx512(point, width * height, other_intrinsics, extr, res1, res);
+            break;
+        case simd_level::avx2:
+            project_points_avx2(point, width * height, other_intrinsics, extr, res1, res);
+            break;
+        default:
+            project_points_sse(point, width * height, other_intrinsics, extr, res1, res);
+            break;
+        }
+#endif
+    }
+
+#ifdef __SSSE3__
+    namespace
+    {
+        // pshufb masks interleaving 8 x, 8 y and 8 z words into 3 registers of xyzxyz... words
+        struct vertex_interleave_masks
+        {
+            __m128i masks[3][3]; // [output register][component]
+
+            vertex_interleave_masks()
+            {
+                uint8_t bytes[3][3][16];
+                memset(bytes, 0x80, sizeof(bytes));
+                for (int k = 0; k < 24; ++k)
+                {
+                    int point = k / 3, component = k % 3, reg = k / 8, word = k % 8;
+                    bytes[reg][component][word * 2] = static_cast<uint8_t>(point * 2);
+                    bytes[reg][component][word * 2 + 1] = static_cast<uint8_t>(point * 2 + 1);
+                }
+                for (int reg = 0; reg < 3; ++reg)
+                    for (int component = 0; component < 3; ++component)
+                        masks[reg][component] = _mm_loadu_si128((const __m128i*)bytes[reg][component]);
+            }
+        };
+
+        // SSE2 version of float_to_half, the low 16 bits of every lane hold the half
+        inline __m128i float_to_half_sse(__m128 f)
+        {
+            auto justsign = _mm_and_ps(f, _mm_set1_ps(-0.f));
+            auto absf = _mm_castps_si128(_mm_xor_ps(f, justsign));
+
+            auto is_nan = _mm_cmpgt_epi32(absf, _mm_set1_epi32(0x7f800000));
+            auto is_regular = _mm_cmpgt_epi32(_mm_set1_epi32(0x47800000), absf);
+            auto inf_or_nan = _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+
+            auto is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), absf);
+            auto magic = _mm_set1_epi32(126 << 23);
+            auto subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absf), _mm_castsi128_ps(magic))), magic);
+
+            auto mant_odd = _mm_srli_epi32(_mm_slli_epi32(absf, 18), 31);
+            auto normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(absf, _mm_set1_epi32((int)0xc8000fffu)), mant_odd), 13);
+
+            auto nonspecial = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+            auto joined = _mm_or_si128(_mm_and_si128(is_regular, nonspecial), _mm_andnot_si128(is_regular, inf_or_nan));
+            return _mm_or_si128(joined, _mm_srli_epi32(_mm_castps_si128(justsign), 16));
+        }
+
+        // Pack the low 16 bits of the lanes of two registers, (v << 16) >> 16 keeps _mm_packs_epi32 from saturating them
+        inline __m128i pack_low_words(__m128i a, __m128i b)
+        {
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+        }
+
+        inline __m128i to_unorm16_sse(__m128 v)
+        {
+            v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.f));
+            return _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(65535.f)));
+        }
+    }
+
+    void deproject_points_packed_sse(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        rs2_format format, float vertex_scale, const rs2_intrinsics* to, const rs2_extrinsics* extr, uint16_t* vertices, uint16_t* tex)
+    {
+        static const vertex_interleave_masks interleave;
+
+        bool fixed = format == RS2_FORMAT_XYZ16;
+        auto inv_scale_value = 1.f / vertex_scale;
+        auto inv_scale = _mm_set1_ps(inv_scale_value);
+        auto scale = _mm_set1_ps(depth_scale);
+        auto zero = _mm_setzero_si128();
+
+        __m128 r[9], t[3], c[5];
+        __m128 fx, fy, ppx, ppy, w, h;
+        bool distort = false;
+        if (to)
+        {
+            for (int i = 0; i < 9; ++i) r[i] = _mm_set_ps1(extr->rotation[i]);
+            for (int i = 0; i < 3; ++i) t[i] = _mm_set_ps1(extr->translation[i]);
+            for (int i = 0; i < 5; ++i) c[i] = _mm_set_ps1(to->coeffs[i]);
+            fx = _mm_set_ps1(to->fx);
+            fy = _mm_set_ps1(to->fy);
+            ppx = _mm_set_ps1(to->ppx);
+            ppy = _mm_set_ps1(to->ppy);
+            w = _mm_set_ps1((float)to->width);
+            h = _mm_set_ps1((float)to->height);
+            distort = to->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY;
+        }
+        auto one = _mm_set_ps1(1);
+        auto two = _mm_set_ps1(2);
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            auto d = _mm_loadu_si128((const __m128i*)(depth + i));
+            __m128 z[2] = { _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(d, zero)), scale),
+                            _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(d, zero)), scale) };
+            __m128 x[2], y[2];
+            for (int k = 0; k < 2; ++k)
+            {
+                x[k] = _mm_mul_ps(z[k], _mm_loadu_ps(map_x + i + k * 4));
+                y[k] = _mm_mul_ps(z[k], _mm_loadu_ps(map_y + i + k * 4));
+            }
+
+            __m128i xyz[3];
+            const __m128* components[3] = { x, y, z };
+            for (int k = 0; k < 3; ++k)
+            {
+                auto v = components[k];
+                xyz[k] = fixed ?
+                    _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(v[0], inv_scale)), _mm_cvtps_epi32(_mm_mul_ps(v[1], inv_scale))) :
+                    pack_low_words(float_to_half_sse(v[0]), float_to_half_sse(v[1]));
+            }
+            for (int reg = 0; reg < 3; ++reg)
+            {
+                auto out = _mm_or_si128(_mm_or_si128(
+                    _mm_shuffle_epi8(xyz[0], interleave.masks[reg][0]),
+                    _mm_shuffle_epi8(xyz[1], interleave.masks[reg][1])),
+                    _mm_shuffle_epi8(xyz[2], interleave.masks[reg][2]));
+                _mm_storeu_si128((__m128i*)(vertices + i * 3 + reg * 8), out);
+            }
+
+            if (!to)
+            {
+                _mm_storeu_si128((__m128i*)(tex + i * 2), zero);
+                _mm_storeu_si128((__m128i*)(tex + i * 2 + 8), zero);
+                continue;
+            }
+
+            // Same operations as project_points_sse
+            __m128i u[2], v[2];
+            for (int k = 0; k < 2; ++k)
+            {
+                auto p_x = _mm_add_ps(_mm_mul_ps(r[0], x[k]), _mm_add_ps(_mm_mul_ps(r[3], y[k]), _mm_add_ps(_mm_mul_ps(r[6], z[k]), t[0])));
+                auto p_y = _mm_add_ps(_mm_mul_ps(r[1], x[k]), _mm_add_ps(_mm_mul_ps(r[4], y[k]), _mm_add_ps(_mm_mul_ps(r[7], z[k]), t[1])));
+                auto p_z = _mm_add_ps(_mm_mul_ps(r[2], x[k]), _mm_add_ps(_mm_mul_ps(r[5], y[k]), _mm_add_ps(_mm_mul_ps(r[8], z[k]), t[2])));
+
+                p_x = _mm_div_ps(p_x, p_z);
+                p_y = _mm_div_ps(p_y, p_z);
+
+                if (distort)
+                {
+                    auto r2 = _mm_add_ps(_mm_mul_ps(p_x, p_x), _mm_mul_ps(p_y, p_y));
+                    auto r3 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2, r2)), _mm_mul_ps(c[4], _mm_mul_ps(r2, _mm_mul_ps(r2, r2))));
+                    auto f = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(c[0], r2), r3));
+
+                    auto x_f = _mm_mul_ps(p_x, f);
+                    auto y_f = _mm_mul_ps(p_y, f);
+
+                    auto r4 = _mm_mul_ps(c[3], _mm_add_ps(r2, _mm_mul_ps(two, _mm_mul_ps(x_f, x_f))));
+                    p_x = _mm_add_ps(x_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[2], _mm_mul_ps(x_f, y_f))), r4));
+                    p_y = _mm_add_ps(y_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[3], _mm_mul_ps(x_f, y_f))), r4));
+                }
+
+                auto valid = _mm_cmpneq_ps(z[k], _mm_setzero_ps());
+                p_x = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_x, fx), ppx), valid);
+                p_y = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_y, fy), ppy), valid);
+
+                u[k] = to_unorm16_sse(_mm_div_ps(p_x, w));
+                v[k] = to_unorm16_sse(_mm_div_ps(p_y, h));
+            }
+            auto us = pack_low_words(u[0], u[1]);
+            auto vs = pack_low_words(v[0], v[1]);
+            _mm_storeu_si128((__m128i*)(tex + i * 2), _mm_unpacklo_epi16(us, vs));
+            _mm_storeu_si128((__m128i*)(tex + i * 2 + 8), _mm_unpackhi_epi16(us, vs));
+        }
+
+        // The scalar helpers are local to this unit, compiled for the SSE target like the loop above
+        for (; i < count; ++i)
+        {
+            float point[3];
+            deproject_points_scalar(depth + i, depth_scale, map_x + i, map_y + i, point, 1);
+            for (int k = 0; k < 3; ++k)
+                vertices[i * 3 + k] = fixed ? static_cast<uint16_t>(float_to_fixed16(point[k], inv_scale_value)) : float_to_half(point[k]);
+
+            float pixel[2], uv[2] = { 0.f, 0.f };
+            if (to)
+                project_points_scalar(point, 1, *to, *extr, pixel, uv);
+            tex[i * 2] = to ? float_to_unorm16(uv[0]) : 0;
+            tex[i * 2 + 1] = to ? float_to_unorm16(uv[1]) : 0;
+        }
+    }
+#endif
+
+    bool pointcloud_sse::depth_to_packed_points(librealsense::points* output,
+        const uint16_t* depth,
+        float depth_scale,
+        const int* indices,
+        size_t count,
+        const rs2_intrinsics* other_intrinsics,
+        const rs2_extrinsics* extr)
+    {
+#ifdef __SSSE3__
+        const float* map_x = _pre_compute_map->x.data();
+        const float* map_y = _pre_compute_map->y.data();
+
+        if (indices)
+        {
+            // Gather the valid pixels so the kernel runs over contiguous arrays
+            _valid_depth.resize(count);
+            _valid_map_x.resize(count);
+            _valid_map_y.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto j = indices[i];
+                _valid_depth[i] = depth[j];
+                _valid_map_x[i] = map_x[j];
+                _valid_map_y[i] = map_y[j];
+            }
+            depth = _valid_depth.data();
+            map_x = _valid_map_x.data();
+            map_y = _valid_map_y.data();
+        }
+
+        deproject_points_packed_sse(depth, depth_scale, map_x, map_y, count,
+            output->get_vertex_format(), output->get_vertex_scale(), other_intrinsics, extr,
+            (uint16_t*)output->get_vertex_data(), (uint16_t*)output->get_texture_coordinate_data());
+        return true;
+#else
+        return false;
+#endif
     }
 }
@@ -3,9 +3,21 @@
 
 #pragma once
 #include "../pointcloud.h"
+#include "simd-kernels.h"
+#include "../deprojection-map-cache.h"
 
 namespace librealsense
 {
+    // 128-bit kernels, the reference the AVX2 / AVX-512 kernels are dispatched from
+    void deproject_points_sse(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, float* points, size_t count);
+    void project_points_sse(const float* points, size_t count, const rs2_intrinsics& to, const rs2_extrinsics& extr, float* pixels, float* tex);
+
+    // deproject_points_sse and, when to is set, project_points_sse in a single pass writing the packed vertex format
+    // straight away: three int16 (xyz / vertex_scale) for RS2_FORMAT_XYZ16 or three halves for RS2_FORMAT_XYZ16F per vertex,
+    // and two normalized uint16 texture coordinates (zero when to is not set). Same values as pack_points over the float kernels
+    void deproject_points_packed_sse(const uint16_t* depth, float depth_scale, const float* map_x, const float* map_y, size_t count,
+        rs2_format format, float vertex_scale, const rs2_intrinsics* to, const rs2_extrinsics* extr, uint16_t* vertices, uint16_t* tex);
+
     class pointcloud_sse : public pointcloud
     {
     public:
@@ -25,10 +37,20 @@ namespace librealsense
             const rs2_intrinsics &other_intrinsics,
             const rs2_extrinsics& extr,
             float2* pixels_ptr) override;
+        bool depth_to_packed_points(
+            librealsense::points* output,
+            const uint16_t* depth,
+            float depth_scale,
+            const int* indices,
+            size_t count,
+            const rs2_intrinsics* other_intrinsics,
+            const rs2_extrinsics* extr) override;
 
-        std::vector<float> _pre_compute_map_x;
-        std::vector<float> _pre_compute_map_y;
-
-        void pre_compute_x_y_map();
+        std::shared_ptr<const deprojection_map> _pre_compute_map;
+        // Depth and deprojection map of the valid pixels, gathered for sparse packed output
+        std::vector<uint16_t> _valid_depth;
+        std::vector<float> _valid_map_x;
+        std::vector<float> _valid_map_y;
+        simd_level _simd_level;
     };
 }
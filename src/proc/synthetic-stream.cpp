@@ -8,8 +8,72 @@
 #include "context.h"
 #include "stream.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 namespace librealsense
 {
+    processing_block_stats::processing_block_stats()
+        : _enabled(false), _allocated_bytes(0)
+    {
+        reset();
+    }
+
+    void processing_block_stats::reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _allocated_bytes = 0;
+        _calls = 0;
+        _dropped = 0;
+        _total_latency_ms = 0;
+        _latencies.clear();
+        _next_latency = 0;
+    }
+
+    void processing_block_stats::add_call(double latency_ms, bool dropped)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_calls;
+        if (dropped) ++_dropped;
+        _total_latency_ms += latency_ms;
+
+        if (_latencies.size() < latency_window)
+            _latencies.push_back(static_cast<float>(latency_ms));
+        else
+            _latencies[_next_latency] = static_cast<float>(latency_ms);
+        _next_latency = (_next_latency + 1) % latency_window;
+    }
+
+    rs2_processing_block_stats processing_block_stats::get() const
+    {
+        std::vector<float> latencies;
+        rs2_processing_block_stats stats{};
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            stats.calls = _calls;
+            stats.frames_dropped = _dropped;
+            stats.mean_latency_ms = _calls ? static_cast<float>(_total_latency_ms / _calls) : 0.f;
+            latencies = _latencies;
+        }
+        stats.allocated_bytes = _allocated_bytes;
+
+        // Nearest rank percentiles of the latency window
+        auto percentile = [&latencies](double p)
+        {
+            auto rank = static_cast<size_t>(std::ceil(p * latencies.size()));
+            auto nth = latencies.begin() + (rank ? rank - 1 : 0);
+            std::nth_element(latencies.begin(), nth, latencies.end());
+            return *nth;
+        };
+        if (!latencies.empty())
+        {
+            stats.p50_latency_ms = percentile(0.5);
+            stats.p99_latency_ms = percentile(0.99);
+        }
+        return stats;
+    }
+
     void processing_block::set_processing_callback(frame_processor_callback_ptr callback)
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -22,7 +86,7 @@ namespace librealsense
     }
 
     processing_block::processing_block(const char* name) :
-        _source_wrapper(_source)
+        _source_wrapper(_source, &_stats)
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
@@ -32,6 +96,18 @@ namespace librealsense
     void processing_block::invoke(frame_holder f)
     {
         auto callback = _source.begin_callback();
+
+        // A single flag check when the stats are disabled
+        bool measure = _stats.is_enabled();
+        std::chrono::high_resolution_clock::time_point start;
+        unsigned long long frames_ready = 0;
+        if (measure)
+        {
+            frames_ready = _source_wrapper.get_frames_ready();
+            start = std::chrono::high_resolution_clock::now();
+        }
+
+        bool failed = false;
         try
         {
             if (_callback)
@@ -45,16 +121,27 @@ namespace librealsense
         catch (...)
         {
             LOG_ERROR("Exception was thrown during user processing callback!");
+            failed = true;
+        }
+
+        if (measure)
+        {
+            std::chrono::duration<double, std::milli> latency = std::chrono::high_resolution_clock::now() - start;
+            _stats.add_call(latency.count(), failed || _source_wrapper.get_frames_ready() == frames_ready);
         }
     }
 
     generic_processing_block::generic_processing_block(const char* name)
-        : processing_block(name)
+        : processing_block(name), _exclusive_input(nullptr)
     {
         auto on_frame = [this](rs2::frame f, const rs2::frame_source& source)
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // The ownership is checked before the frame is referenced again below
+            auto input = dynamic_cast<frame*>((frame_interface*)f.get());
+            _exclusive_input = (input && input->is_exclusive() && !f.is<rs2::frameset>()) ? input : nullptr;
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -94,6 +181,27 @@ namespace librealsense
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
     }
 
+    rs2::frame generic_processing_block::get_in_place_target(const rs2::frame& f, const rs2::stream_profile& profile,
+        int bpp, int width, int height, int stride, rs2_extension frame_type)
+    {
+        auto fi = (frame_interface*)f.get();
+        if (!fi || fi != _exclusive_input)
+            return rs2::frame();
+
+        auto vf = dynamic_cast<video_frame*>(fi);
+        if (!vf || vf->get_bpp() != bpp * 8 || vf->get_width() != width || vf->get_height() != height || vf->get_stride() != stride)
+            return rs2::frame();
+
+        bool same_type = (frame_type == RS2_EXTENSION_DISPARITY_FRAME) ? f.is<rs2::disparity_frame>() :
+            (frame_type == RS2_EXTENSION_DEPTH_FRAME) ? (f.is<rs2::depth_frame>() && !f.is<rs2::disparity_frame>()) :
+            (frame_type == RS2_EXTENSION_VIDEO_FRAME);
+        if (!same_type)
+            return rs2::frame();
+
+        fi->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(profile.get()->profile->shared_from_this()));
+        return f;
+    }
+
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
     {
         // this function prepares the processing block output frame(s) by the following heuristic:
@@ -307,6 +415,8 @@ namespace librealsense
 
     void synthetic_source::frame_ready(frame_holder result)
     {
+        if (_stats && _stats->is_enabled() && result)
+            ++_frames_ready;
         _actual_source.invoke_callback(std::move(result));
     }
 
@@ -323,8 +433,10 @@ namespace librealsense
             data.system_time = _actual_source.get_time();
             data.is_blocking = original->is_blocking();
 
-            auto res = _actual_source.alloc_frame(frame_type, vid_stream->get_width() * vid_stream->get_height() * sizeof(float) * 5, data, true);
+            auto size = vid_stream->get_width() * vid_stream->get_height() * points::get_point_size(stream->get_format());
+            auto res = _actual_source.alloc_frame(frame_type, size, data, true);
             if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+            add_allocation(size);
             res->set_sensor(original->get_sensor());
             res->set_stream(stream);
             return res;
@@ -386,6 +498,7 @@ namespace librealsense
         frame_additional_data data = of->additional_data;
         auto res = _actual_source.alloc_frame(frame_type, stride * height, data, true);
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+        add_allocation(stride * height);
         vf = dynamic_cast<video_frame*>(res);
         vf->metadata_parsers = of->metadata_parsers;
         vf->assign(width, height, stride, bpp);
@@ -409,6 +522,7 @@ namespace librealsense
         frame_additional_data data = of->additional_data;
         auto res = _actual_source.alloc_frame(frame_type, of->get_frame_data_size(), data, true);
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+        add_allocation(of->get_frame_data_size());
         auto mf = dynamic_cast<motion_frame*>(res);
         mf->metadata_parsers = of->metadata_parsers;
         mf->set_sensor(original->get_sensor());
@@ -11,11 +11,39 @@
 
 namespace librealsense
 {
+    // Performance counters of a processing block, nothing is collected while disabled
+    class processing_block_stats
+    {
+    public:
+        processing_block_stats();
+
+        bool is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+        void enable(bool state) { _enabled = state; }
+        void reset();
+
+        void add_call(double latency_ms, bool dropped);
+        void add_allocation(size_t bytes) { if (is_enabled()) _allocated_bytes += bytes; }
+
+        rs2_processing_block_stats get() const;
+
+    private:
+        static const size_t latency_window = 1024;   // Latest invocations the percentiles are computed over
+
+        std::atomic<bool> _enabled;
+        std::atomic<unsigned long long> _allocated_bytes;
+        mutable std::mutex _mutex;
+        unsigned long long _calls;
+        unsigned long long _dropped;
+        double _total_latency_ms;
+        std::vector<float> _latencies;
+        size_t _next_latency;
+    };
+
     class synthetic_source : public synthetic_source_interface
     {
     public:
-        synthetic_source(frame_source& actual)
-            : _actual_source(actual), _c_wrapper(new rs2_source{ this })
+        synthetic_source(frame_source& actual, processing_block_stats* stats = nullptr)
+            : _actual_source(actual), _c_wrapper(new rs2_source{ this }), _stats(stats), _frames_ready(0)
         {
         }
 
@@ -40,9 +68,16 @@ namespace librealsense
 
         rs2_source* get_c_wrapper() override { return _c_wrapper.get(); }
 
+        // Number of frames delivered so far, counted while the stats are enabled
+        unsigned long long get_frames_ready() const { return _frames_ready; }
+
     private:
+        void add_allocation(size_t bytes) { if (_stats) _stats->add_allocation(bytes); }
+
         frame_source & _actual_source;
         std::shared_ptr<rs2_source> _c_wrapper;
+        processing_block_stats* _stats;
+        std::atomic<unsigned long long> _frames_ready;
     };
 
     class LRS_EXTENSION_API processing_block : public processing_block_interface, public options_container, public info_container
@@ -55,11 +90,14 @@ namespace librealsense
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
 
+        processing_block_stats& get_stats() { return _stats; }
+
         virtual ~processing_block() { _source.flush(); }
     protected:
         frame_source _source;
         std::mutex _mutex;
         frame_processor_callback_ptr _callback;
+        processing_block_stats _stats;
         synthetic_source _source_wrapper;
     };
 
@@ -74,6 +112,15 @@ namespace librealsense
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // For filters that would allocate a target frame and work on a copy of their input: the input frame itself,
+        // moved to the target profile, when the caller handed its only reference over and its layout matches the target.
+        // Returns an empty frame otherwise
+        rs2::frame get_in_place_target(const rs2::frame& f, const rs2::stream_profile& profile,
+            int bpp, int width, int height, int stride, rs2_extension frame_type);
+
+    private:
+        frame_interface* _exclusive_input;  // Input frame the block holds the only reference to, while it is processed
     };
 
     struct stream_filter
@@ -38,9 +38,12 @@ namespace librealsense
         _alpha_param(temp_alpha_default),
         _one_minus_alpha(1- _alpha_param),
         _delta_param(temp_delta_default),
-        _width(0), _height(0), _stride(0), _bpp(0),
+        _width(0), _height(0), _stride(0),
+        _target_width(0), _target_height(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
-        _current_frm_size_pixels(0)
+        _current_frm_size_pixels(0),
+        _roi(*this, _mutex, [this]() { _source_stream_profile = rs2::stream_profile(); }),
+        _roi_rect{}
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -113,12 +116,17 @@ namespace librealsense
         update_configuration(f);
         auto tgt = prepare_target_frame(f, source);
 
+        // The filter runs on the region of interest only, a cropped target frame is all of it
+        auto rect = _roi.crop() ? pixel_rect{ 0, 0, int(_width), int(_height) } : _roi_rect;
+        auto data = _roi.gather(const_cast<void*>(tgt.get_data()), int(_target_width), int(_target_height), _bpp, rect);
+
         // Temporal filter execution
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            temp_jw_smooth<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temp_jw_smooth<float>(data, _last_frame.data(), _history.data());
         else
-            temp_jw_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temp_jw_smooth<uint16_t>(data, _last_frame.data(), _history.data());
 
+        _roi.scatter(const_cast<void*>(tgt.get_data()), int(_target_width), int(_target_height), _bpp, rect);
         return tgt;
     }
 
@@ -153,18 +161,30 @@ namespace librealsense
 
     void  temporal_filter::update_configuration(const rs2::frame& f)
     {
-        if (f.get_profile().get() != _source_stream_profile.get())
-        {
-            _source_stream_profile = f.get_profile();
-            _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
+        //TODO - reject any frame other than depth/disparity
+        update_configuration(f.get_profile(), f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME);
+    }
 
-            //TODO - reject any frame other than depth/disparity
-            _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+    void  temporal_filter::update_configuration(const rs2::stream_profile& profile, rs2_extension type)
+    {
+        if (profile.get() != _source_stream_profile.get())
+        {
+            _source_stream_profile = profile;
+            auto source_vp = profile.as<rs2::video_stream_profile>();
+            _roi_rect = _roi.get(source_vp.width(), source_vp.height());
+            if (_roi.crop())
+                _target_stream_profile = _roi.get_cropped_profile(_source_stream_profile, _roi_rect);
+            else
+                _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
+
+            _extension_type = type;
             _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
-            _width = vp.width();
-            _height = vp.height();
-            _stride = _width*_bpp;
+            _target_width = vp.width();
+            _target_height = vp.height();
+            _width = _roi_rect.width;
+            _height = _roi_rect.height;
+            _stride = _target_width*_bpp;
             _current_frm_size_pixels = _width * _height;
 
             _last_frame.clear();
@@ -178,10 +198,18 @@ namespace librealsense
 
     rs2::frame temporal_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
+        // Filter the input directly when the caller handed it over
+        if (auto tgt = get_in_place_target(f, _target_stream_profile, (int)_bpp, (int)_target_width, (int)_target_height, (int)_stride, _extension_type))
+            return tgt;
+
+        // A cropped target holds the region of interest of the input only
+        if (_roi.crop())
+            return _roi.crop_frame(source, f, _roi_rect, _extension_type);
+
         // Allocate and copy the content of the original Depth data to the target
-        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height, (int)_stride, _extension_type);
+        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_target_width, (int)_target_height, (int)_stride, _extension_type);
 
-        memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
+        memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _target_width * _target_height * _bpp);
         return tgt;
     }
 
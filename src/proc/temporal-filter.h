@@ -3,6 +3,7 @@
 
 #pragma once
 #include "types.h"
+#include "proc/processing-roi.h"
 
 namespace librealsense
 {
@@ -15,6 +16,7 @@ namespace librealsense
 
     protected:
         void    update_configuration(const rs2::frame& f);
+        void    update_configuration(const rs2::stream_profile& profile, rs2_extension type);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
@@ -84,6 +86,8 @@ namespace librealsense
         }
 
     private:
+        friend class depth_post_processing;
+
         void on_set_persistence_control(uint8_t val);
         void on_set_alpha(float val);
         void on_set_delta(float val);
@@ -94,7 +98,8 @@ namespace librealsense
         float                   _alpha_param;               // The normalized weight of the current pixel
         float                   _one_minus_alpha;
         uint8_t                 _delta_param;               // A threshold when a filter is invoked
-        size_t                  _width, _height, _stride;
+        size_t                  _width, _height, _stride;   // Size of the region filtered, stride of the target frame
+        size_t                  _target_width, _target_height;
         size_t                  _bpp;
         rs2_extension           _extension_type;            // Strictly Depth/Disparity
         size_t                  _current_frm_size_pixels;
@@ -105,6 +110,8 @@ namespace librealsense
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
+        processing_roi          _roi;
+        pixel_rect              _roi_rect;                  // Region of interest of the input frame, the history covers it alone
     };
     MAP_EXTENSION(RS2_EXTENSION_TEMPORAL_FILTER, librealsense::temporal_filter);
 }
@@ -38,6 +38,24 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
+
+        // Clear the out of range pixels of the input directly when the caller handed it over
+        if (auto tgt = get_in_place_target(f, _target_stream_profile,
+            vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME))
+        {
+            auto depth = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)tgt.get());
+            auto data = (uint16_t*)depth->get_frame_data();
+            auto du = depth->get_units();
+
+            for (int i = 0; i < width * height; i++)
+            {
+                auto dist = du * data[i];
+                if (!(dist >= _min && dist <= _max)) data[i] = 0;
+            }
+
+            return tgt;
+        }
+
         auto new_f = source.allocate_video_frame(_target_stream_profile, f,
             vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
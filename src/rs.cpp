@@ -28,6 +28,9 @@
 #include "proc/spatial-filter.h"
 #include "proc/zero-order.h"
 #include "proc/hole-filling-filter.h"
+#include "proc/depth-post-processing.h"
+#include "proc/processing-graph.h"
+#include "proc/processing-batch.h"
 #include "proc/color-formats-converter.h"
 #include "proc/rates-printer.h"
 #include "media/playback/playback_device.h"
@@ -273,6 +276,25 @@ rs2_device* rs2_create_device(const rs2_device_list* info_list, int index, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, info_list, index)
 
+void rs2_create_devices(const rs2_device_list* info_list, rs2_device** devices, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(info_list);
+    VALIDATE_RANGE(count, (int)info_list->list.size(), (int)info_list->list.size());
+    // An empty list needs no array, as with an empty vector
+    if (count == 0)
+        return;
+    VALIDATE_NOT_NULL(devices);
+
+    std::vector<std::shared_ptr<librealsense::device_info>> infos;
+    for (auto&& item : info_list->list)
+        infos.push_back(item.info);
+
+    auto created = info_list->ctx->create_devices_concurrently(infos);
+    for (int i = 0; i < count; ++i)
+        devices[i] = new rs2_device{ info_list->ctx, info_list->list[i].info, created[i] };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, info_list, devices, count)
+
 void rs2_delete_device(rs2_device* device) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -521,6 +543,22 @@ float rs2_get_option(const rs2_options* options, rs2_option option, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0.0f, options, option)
 
+void rs2_get_options_values(const rs2_options* options, const rs2_option* option_ids, float* values, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(options);
+    VALIDATE_NOT_NULL(option_ids);
+    VALIDATE_NOT_NULL(values);
+    VALIDATE_RANGE(count, 0, std::numeric_limits<int>::max());
+
+    std::vector<rs2_option> ids(option_ids, option_ids + count);
+    for (auto id : ids)
+        VALIDATE_OPTION(options, id);
+
+    auto result = options->options->query_options(ids);
+    std::copy(result.begin(), result.end(), values);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, options, option_ids, values, count)
+
 void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(options);
@@ -1862,6 +1900,8 @@ rs2_vertex* rs2_get_frame_vertices(const rs2_frame* frame, rs2_error** error) BE
 {
     VALIDATE_NOT_NULL(frame);
     auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    if (points->get_vertex_format() != RS2_FORMAT_XYZ32F)
+        throw invalid_value_exception("packed vertex format, use rs2_get_frame_packed_vertices");
     return (rs2_vertex*)points->get_vertices();
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
@@ -1879,6 +1919,8 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 {
     VALIDATE_NOT_NULL(frame);
     auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    if (points->get_vertex_format() != RS2_FORMAT_XYZ32F)
+        throw invalid_value_exception("packed vertex format, use rs2_get_frame_packed_texture_coordinates");
     return (rs2_pixel*)points->get_texture_coordinates();
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
@@ -1891,6 +1933,46 @@ int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
+int rs2_get_frame_motion_samples_count(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto motion = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return static_cast<int>(motion->get_samples_count());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+const int* rs2_get_frame_pixel_indices(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_pixel_indices();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
+const void* rs2_get_frame_packed_vertices(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_vertex_data();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
+const void* rs2_get_frame_packed_texture_coordinates(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_texture_coordinate_data();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
+float rs2_get_frame_vertex_scale(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_vertex_scale();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0.f, frame)
+
 rs2_processing_block* rs2_create_pointcloud(rs2_error** error) BEGIN_API_CALL
 {
     return new rs2_processing_block { pointcloud::create() };
@@ -1994,6 +2076,119 @@ rs2_processing_block* rs2_create_zero_order_invalidation_block(rs2_error** error
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_depth_post_processing_block(rs2_processing_block** filters, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(filters);
+    VALIDATE_RANGE(count, 1, 6);
+
+    std::vector<std::shared_ptr<librealsense::processing_block>> stages;
+    for (int i = 0; i < count; i++)
+    {
+        VALIDATE_NOT_NULL(filters[i]);
+        auto stage = std::dynamic_pointer_cast<librealsense::processing_block>(filters[i]->block);
+        if (!stage)
+            throw librealsense::invalid_value_exception("Depth post-processing supports the depth post-processing filters only");
+        stages.push_back(stage);
+    }
+
+    auto block = std::make_shared<librealsense::depth_post_processing>(stages);
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, filters, count)
+
+void rs2_enable_processing_block_stats(rs2_processing_block* block, int enable, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto pb = std::dynamic_pointer_cast<librealsense::processing_block>(block->block);
+    if (!pb)
+        throw librealsense::invalid_value_exception("Processing block does not support performance counters");
+    pb->get_stats().enable(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, enable)
+
+void rs2_get_processing_block_stats(const rs2_processing_block* block, rs2_processing_block_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_NOT_NULL(stats);
+    auto pb = std::dynamic_pointer_cast<librealsense::processing_block>(block->block);
+    if (!pb)
+        throw librealsense::invalid_value_exception("Processing block does not support performance counters");
+    *stats = pb->get_stats().get();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, stats)
+
+void rs2_reset_processing_block_stats(rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto pb = std::dynamic_pointer_cast<librealsense::processing_block>(block->block);
+    if (!pb)
+        throw librealsense::invalid_value_exception("Processing block does not support performance counters");
+    pb->get_stats().reset();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block)
+
+rs2_processing_block* rs2_create_processing_graph(int max_in_flight, rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::processing_graph>(max_in_flight);
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, max_in_flight)
+
+int rs2_processing_graph_add_block(rs2_processing_block* graph, rs2_processing_block* block, const int* inputs, int inputs_count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(graph);
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_RANGE(inputs_count, 0, std::numeric_limits<int>::max());
+    if (inputs_count) VALIDATE_NOT_NULL(inputs);
+
+    auto g = std::dynamic_pointer_cast<librealsense::processing_graph>(graph->block);
+    if (!g)
+        throw librealsense::invalid_value_exception("Processing block is not a processing graph");
+    return g->add(block->block, std::vector<int>(inputs, inputs + inputs_count));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, graph, block, inputs, inputs_count)
+
+rs2_processing_block* rs2_create_processing_batch(int threads, rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::processing_batch>(threads);
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, threads)
+
+void rs2_processing_batch_add_stage(rs2_processing_block* batch, rs2_processing_block** blocks, int blocks_count, int ordered, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(batch);
+    VALIDATE_NOT_NULL(blocks);
+    VALIDATE_RANGE(blocks_count, 1, std::numeric_limits<int>::max());
+
+    auto b = std::dynamic_pointer_cast<librealsense::processing_batch>(batch->block);
+    if (!b)
+        throw librealsense::invalid_value_exception("Processing block is not a processing batch");
+
+    std::vector<std::shared_ptr<librealsense::processing_block_interface>> stage;
+    for (int i = 0; i < blocks_count; ++i)
+    {
+        VALIDATE_NOT_NULL(blocks[i]);
+        stage.push_back(blocks[i]->block);
+    }
+    b->add_stage(stage, ordered != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, batch, blocks, blocks_count, ordered)
+
+void rs2_processing_batch_flush(rs2_processing_block* batch, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(batch);
+
+    auto b = std::dynamic_pointer_cast<librealsense::processing_batch>(batch->block);
+    if (!b)
+        throw librealsense::invalid_value_exception("Processing block is not a processing batch");
+    b->flush();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, batch)
+
 float rs2_get_depth_scale(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -2337,6 +2532,15 @@ int rs2_get_recommended_processing_blocks_count(const rs2_processing_block_list*
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, list)
 
+rs2_processing_block_list* rs2_get_sensor_processing_blocks(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    // Only synthetic sensors run processing blocks of their own
+    auto synthetic = dynamic_cast<librealsense::synthetic_sensor*>(sensor->sensor);
+    return new rs2_processing_block_list{ synthetic ? synthetic->get_active_processing_blocks() : processing_blocks() };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
+
 void rs2_delete_recommended_processing_blocks(rs2_processing_block_list* list) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(list);
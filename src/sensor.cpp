@@ -237,13 +237,16 @@ namespace librealsense
         frame_timestamp_reader* timestamp_reader,
         const rs2_time_t& last_timestamp,
         const unsigned long long& last_frame_number,
-        std::shared_ptr<stream_profile_interface> profile)
+        std::shared_ptr<stream_profile_interface> profile,
+        bool copy_data)
     {
         auto system_time = environment::get_instance().get_time_service()->get_time();
         auto fr = std::make_shared<frame>();
         byte* pix = (byte*)fo.pixels;
-        std::vector<byte> pixels(pix, pix + fo.frame_size);
-        fr->data = pixels;
+        if (copy_data)
+            fr->data.assign(pix, pix + fo.frame_size);
+        else
+            fr->attach_continuation(frame_continuation([]() {}, fo.pixels, fo.frame_size)); // Valid while fo is
         fr->set_stream(profile);
 
         // generate additional data
@@ -267,12 +270,183 @@ namespace librealsense
         return fr;
     }
 
+    //////////////////////////////////////////////////////
+    /////////////////// Option Cache /////////////////////
+    //////////////////////////////////////////////////////
+
+    option_cache::option_cache(int refresh_ms)
+        : _refresh_queued(false), _generation(0), _refresh_ms(refresh_ms)
+    {
+    }
+
+    option_cache::~option_cache()
+    {
+        stop();
+    }
+
+    void option_cache::enable()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_refresher)
+        {
+            // A single refresh is queued at a time, it reads all the options gone stale meanwhile
+            _refresher = std::unique_ptr<dispatcher>(new dispatcher(1));
+            _refresher->start();
+        }
+    }
+
+    void option_cache::stop()
+    {
+        std::unique_ptr<dispatcher> refresher;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            refresher = std::move(_refresher);
+            _values.clear();
+            _stale.clear();
+            ++_generation;
+        }
+        // Waits for a running refresh, which takes the lock to store its values
+        refresher.reset();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _refresh_queued = false;
+    }
+
+    void option_cache::invalidate()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _values.clear();
+        _stale.clear();
+        ++_generation;
+    }
+
+    void option_cache::defer_reads(bool defer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (defer)
+            _deferred[std::this_thread::get_id()] = 0;
+        else
+            _deferred.erase(std::this_thread::get_id());
+    }
+
+    int option_cache::deferred_reads()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _deferred.find(std::this_thread::get_id());
+        return it != _deferred.end() ? it->second : 0;
+    }
+
+    void option_cache::refresh()
+    {
+        std::map<const option*, std::function<float()>> stale;
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            stale.swap(_stale);
+            generation = _generation;
+            _refresh_queued = false;
+        }
+
+        using namespace std::chrono;
+        for (auto&& kvp : stale)
+        {
+            float value = 0;
+            bool valid = false;
+            try
+            {
+                value = kvp.second();
+                valid = true;
+            }
+            catch (...)
+            {
+                LOG_DEBUG("Failed to refresh a cached option value");
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_generation != generation)
+                return;
+            auto it = _values.find(kvp.first);
+            if (it == _values.end())
+                continue;
+            // A failed read is retried after another period
+            if (valid)
+                it->second.value = value;
+            it->second.read_time = steady_clock::now();
+            it->second.refreshing = false;
+        }
+    }
+
+    float option_cache::query(const option* opt, std::function<float()> read, bool cacheable)
+    {
+        using namespace std::chrono;
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _values.find(opt);
+            if (cacheable && it != _values.end())
+            {
+                auto& e = it->second;
+                if (!e.refreshing && steady_clock::now() - e.read_time > milliseconds(_refresh_ms))
+                {
+                    // The caller gets the current value, the next one gets the refreshed value
+                    e.refreshing = true;
+                    _stale[opt] = read;
+                    if (!_refresh_queued)
+                    {
+                        _refresh_queued = true;
+                        _refresher->invoke([this](dispatcher::cancellable_timer) { refresh(); });
+                    }
+                }
+                return e.value;
+            }
+
+            auto deferred = _deferred.find(std::this_thread::get_id());
+            if (deferred != _deferred.end())
+            {
+                ++deferred->second;
+                return 0.f;
+            }
+            generation = _generation;
+        }
+
+        auto value = read();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (cacheable && _refresher && _generation == generation)
+            _values[opt] = { value, steady_clock::now(), false };
+        return value;
+    }
+
+    void option_cache::set(const option* opt, float value, std::function<void()> write)
+    {
+        {
+            // The values read before the write are stale whether it succeeded or not
+            std::lock_guard<std::mutex> lock(_mutex);
+            _values.clear();
+            _stale.clear();
+            ++_generation;
+        }
+
+        write();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_refresher)
+        {
+            _values.clear();
+            _stale.clear();
+            ++_generation;
+            _values[opt] = { value, std::chrono::steady_clock::now(), false };
+        }
+    }
+
     //////////////////////////////////////////////////////
     /////////////////// UVC Sensor ///////////////////////
     //////////////////////////////////////////////////////
 
     uvc_sensor::~uvc_sensor()
     {
+        // Background reads of the options power the device, they end before it goes away
+        _option_cache.stop();
         try
         {
             if (_is_streaming)
@@ -309,12 +483,18 @@ namespace librealsense
             {
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
+
+                // Frames delivered in the backend buffers keep them out of the capture queue until released,
+                // past max_retained of them the frames are copied so that the capture never runs out of buffers
+                auto retains_buffers = _device->retains_frame_buffers();
+                auto retained = std::make_shared<std::atomic<int>>(0);
+                const int max_retained = DEFAULT_V4L2_FRAME_BUFFERS / 2;
+
                 _device->probe_and_commit(req_profile_base->get_backend_profile(),
-                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp, retains_buffers, retained, max_retained](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     const auto&& system_time = environment::get_instance().get_time_service()->get_time();
-                    const auto&& fr = generate_frame_from_data(f, _timestamp_reader.get(), last_timestamp, last_frame_number, req_profile_base);
-                    const auto&& requires_processing = true; // TODO - Ariel add option
+                    const auto&& fr = generate_frame_from_data(f, _timestamp_reader.get(), last_timestamp, last_frame_number, req_profile_base, false);
                     const auto&& timestamp_domain = _timestamp_reader->get_frame_timestamp_domain(fr);
                     const auto&& bpp = get_image_bpp(req_profile_base->get_format());
                     auto&& frame_counter = fr->additional_data.frame_number;
@@ -329,8 +509,6 @@ namespace librealsense
                         return;
                     }
 
-                    frame_continuation release_and_enqueue(continuation, f.pixels);
-                    
                     LOG_DEBUG("FrameAccepted," << librealsense::get_string(req_profile_base->get_stream_type())
                         << ",Counter," << std::dec << fr->additional_data.frame_number
                             << ",Index," << req_profile_base->get_stream_index()
@@ -346,11 +524,30 @@ namespace librealsense
                     const auto&& vsp = As<video_stream_profile, stream_profile_interface>(req_profile);
                     int width = vsp ? vsp->get_width() : 0;
                     int height = vsp ? vsp->get_height() : 0;
+                    size_t size = width * height * bpp / 8;
+
+                    // The kernel wrote the frame straight to the backend buffer, which the frame holds until released
+                    const bool requires_memory = !retains_buffers || f.frame_size < size || *retained >= max_retained;
+                    frame_continuation release_and_enqueue;
+                    if (requires_memory)
+                        release_and_enqueue = frame_continuation(continuation, f.pixels);
+                    else
+                    {
+                        ++*retained;
+                        release_and_enqueue = frame_continuation([continuation, retained]()
+                        {
+                            --*retained;
+                            continuation();
+                        }, f.pixels, size);
+                    }
 
-                    frame_holder fh = _source.alloc_frame(stream_to_frame_types(req_profile_base->get_stream_type()), width * height * bpp / 8, fr->additional_data, requires_processing);
+                    frame_holder fh = _source.alloc_frame(stream_to_frame_types(req_profile_base->get_stream_type()), size, fr->additional_data, requires_memory);
                     if (fh.frame)
                     {
-                        memcpy((void*)fh->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
+                        if (requires_memory)
+                            memcpy((void*)fh->get_frame_data(), f.pixels, std::min(size, f.frame_size));
+                        else
+                            fh->attach_continuation(std::move(release_and_enqueue));
                         auto&& video = (video_frame*)fh.frame;
                         video->assign(width, height, width * bpp / 8, bpp);
                         video->set_timestamp_domain(timestamp_domain);
@@ -362,11 +559,6 @@ namespace librealsense
                         return;
                     }
 
-                    if (!requires_processing)
-                    {
-                        fh->attach_continuation(std::move(release_and_enqueue));
-                    }
-
                     if (fh->get_stream().get())
                     {
                         _source.invoke_callback(std::move(fh));
@@ -606,6 +798,45 @@ namespace librealsense
         register_option(id, std::make_shared<uvc_pu_option>(*this, id));
     }
 
+    std::vector<float> uvc_sensor::query_options(const std::vector<rs2_option>& ids) const
+    {
+        return const_cast<uvc_sensor*>(this)->query_options_of(*this, ids);
+    }
+
+    std::vector<float> uvc_sensor::query_options_of(const options_interface& options, const std::vector<rs2_option>& ids)
+    {
+        std::vector<float> values(ids.size());
+        std::vector<size_t> missed;
+        {
+            // The cached values are served without powering the device, the reads they miss are collected
+            struct deferred_reads
+            {
+                option_cache& cache;
+                deferred_reads(option_cache& c) : cache(c) { cache.defer_reads(true); }
+                ~deferred_reads() { cache.defer_reads(false); }
+            } deferred(_option_cache);
+
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                auto before = _option_cache.deferred_reads();
+                values[i] = options.get_option(ids[i]).query();
+                if (_option_cache.deferred_reads() != before)
+                    missed.push_back(i);
+            }
+        }
+
+        // Powered once for all the others, rather than once per option
+        if (!missed.empty())
+        {
+            invoke_powered([&](platform::uvc_device&)
+            {
+                for (auto i : missed)
+                    values[i] = options.get_option(ids[i]).query();
+            });
+        }
+        return values;
+    }
+
     void uvc_sensor::try_register_pu(rs2_option id)
     {
         auto opt = std::make_shared<uvc_pu_option>(*this, id);
@@ -640,7 +871,13 @@ namespace librealsense
       _hid_device(hid_device),
       _is_configured_stream(RS2_STREAM_COUNT),
       _hid_iio_timestamp_reader(move(hid_iio_timestamp_reader)),
-      _custom_hid_timestamp_reader(move(custom_hid_timestamp_reader))
+      _custom_hid_timestamp_reader(move(custom_hid_timestamp_reader)),
+      _batch_size_value(1),
+      _batch_period_value(0),
+      _batch_size(std::make_shared<ptr_option<int>>(1, 1000, 1, 1, &_batch_size_value,
+          "Maximal number of IMU samples delivered per motion frame, 1 delivers every sample in its own frame")),
+      _batch_period(std::make_shared<ptr_option<int>>(0, 1000, 1, 0, &_batch_period_value,
+          "Maximal time span in milliseconds of the IMU samples of a batched motion frame, 0 for no time limit"))
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP, make_additional_data_parser(&frame_additional_data::backend_timestamp));
 
@@ -766,9 +1003,14 @@ namespace librealsense
 
         unsigned long long last_frame_number = 0;
         rs2_time_t last_timestamp = 0;
+        auto batch_size = static_cast<size_t>(_batch_size_value);
+        auto batch_period = static_cast<double>(_batch_period_value);
+        std::map<rs2_stream, motion_batch> batches;
+        // The backend buffers the reports of a batch, so that the capture wakes up once per batch rather than per sample
+        _hid_device->set_report_batching(static_cast<uint32_t>(batch_size), static_cast<uint32_t>(batch_size > 1 ? batch_period : 0));
         raise_on_before_streaming_changes(true); //Required to be just before actual start allow recording to work
 
-        _hid_device->start_capture([this, last_frame_number, last_timestamp](const platform::sensor_data& sensor_data) mutable
+        _hid_device->start_capture([this, last_frame_number, last_timestamp, batch_size, batch_period, batches](const platform::sensor_data& sensor_data) mutable
         {
             const auto&& system_time = environment::get_instance().get_time_service()->get_time();
             auto timestamp_reader = _hid_iio_timestamp_reader.get();
@@ -820,6 +1062,41 @@ namespace librealsense
 
             last_frame_number = frame_counter;
             last_timestamp = timestamp;
+
+            // Batched samples are delivered together once their batch completes, a single archive frame for all of them.
+            // The raw axes are kept in the sample values for the motion transforms
+            if (batch_size > 1 && !is_custom_sensor)
+            {
+                auto&& batch = batches[request->get_stream_type()];
+                if (batch.samples.empty())
+                    batch.additional_data = fr->additional_data;
+
+                rs2_motion_sample sample{};
+                memcpy(&sample.value, fr->data.data(), std::min(sizeof(sample.value), fr->data.size()));
+                sample.timestamp = timestamp;
+                batch.samples.push_back(sample);
+
+                if (batch.samples.size() < batch_size && (batch_period <= 0 || timestamp - batch.samples.front().timestamp < batch_period))
+                    return;
+
+                auto additional_data = batch.additional_data;
+                additional_data.motion_samples = static_cast<uint32_t>(batch.samples.size());
+                frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, batch.samples.size() * sizeof(rs2_motion_sample), additional_data, true);
+                if (!frame)
+                {
+                    LOG_INFO("Dropped " << batch.samples.size() << " motion samples. alloc_frame(...) returned nullptr");
+                    batch.samples.clear();
+                    return;
+                }
+                memcpy((void*)frame->get_frame_data(), batch.samples.data(), batch.samples.size() * sizeof(rs2_motion_sample));
+                batch.samples.clear();
+
+                frame->set_stream(request);
+                frame->set_timestamp_domain(timestamp_domain);
+                _source.invoke_callback(std::move(frame));
+                return;
+            }
+
             frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, fr->additional_data, true);
             memcpy((void*)frame->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
             if (!frame)
@@ -916,6 +1193,10 @@ namespace librealsense
           _timestamp_reader(std::move(timestamp_reader))
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP,     make_additional_data_parser(&frame_additional_data::backend_timestamp));
+
+        // The recorded sessions replay every control transfer, the option values are cached for the live devices only
+        if (dev && dev->get_context() && dev->get_context()->has_live_backend())
+            _option_cache.enable();
     }
 
     iio_hid_timestamp_reader::iio_hid_timestamp_reader()
@@ -1053,6 +1334,14 @@ namespace librealsense
         register_option(id, std::make_shared<uvc_pu_option>(*raw_uvc_sensor.get(), id));
     }
 
+    std::vector<float> synthetic_sensor::query_options(const std::vector<rs2_option>& ids) const
+    {
+        // The options of the synthetic sensor are mostly the controls of its raw sensor
+        if (auto raw_uvc_sensor = std::dynamic_pointer_cast<uvc_sensor>(_raw_sensor))
+            return raw_uvc_sensor->query_options_of(*this, ids);
+        return sensor_base::query_options(ids);
+    }
+
     void synthetic_sensor::sort_profiles(stream_profiles* profiles)
     {
         std::sort(profiles->begin(), profiles->end(), [](const std::shared_ptr<stream_profile_interface>& ap,
@@ -1359,6 +1648,21 @@ namespace librealsense
         set_active_streams(requests);
     }
 
+    processing_blocks synthetic_sensor::get_active_processing_blocks()
+    {
+        std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        processing_blocks blocks;
+        for (auto&& entry : _profiles_to_processing_block)
+        {
+            for (auto&& pb : entry.second)
+            {
+                if (pb && std::find(blocks.begin(), blocks.end(), pb) == blocks.end())
+                    blocks.push_back(pb);
+            }
+        }
+        return blocks;
+    }
+
     void synthetic_sensor::close()
     {
         std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
@@ -20,6 +20,7 @@
 #include "core/roi.h"
 #include "core/options.h"
 #include "source.h"
+#include "concurrency.h"
 #include "core/extension.h"
 #include "proc/processing-blocks-factory.h"
 #include "proc/identity-processing-block.h"
@@ -96,7 +97,8 @@ namespace librealsense
             frame_timestamp_reader* timestamp_reader,
             const rs2_time_t& last_timestamp,
             const unsigned long long& last_frame_number,
-            std::shared_ptr<stream_profile_interface> profile);
+            std::shared_ptr<stream_profile_interface> profile,
+            bool copy_data = true);
 
         std::vector<platform::stream_profile> _internal_config;
 
@@ -136,6 +138,7 @@ namespace librealsense
         void register_option(rs2_option id, std::shared_ptr<option> option);
         void unregister_option(rs2_option id);
         void register_pu(rs2_option id);
+        std::vector<float> query_options(const std::vector<rs2_option>& ids) const override;
 
         virtual stream_profiles init_stream_profiles() override;
 
@@ -151,6 +154,8 @@ namespace librealsense
         void register_processing_block(const std::vector<processing_block_factory>& pbfs);
 
         std::shared_ptr<sensor_base> get_raw_sensor() const { return _raw_sensor; };
+        // The processing blocks producing the open streams from the raw sensor streams
+        processing_blocks get_active_processing_blocks();
         frame_callback_ptr get_frames_callback() const override;
         void set_frames_callback(frame_callback_ptr callback) override;
         void register_notifications_callback(notifications_callback_ptr callback) override;
@@ -227,10 +232,22 @@ namespace librealsense
                                                     const std::string& report_name,
                                                     platform::custom_sensor_report_field report_field) const;
 
+        // Options batching the gyro and accel samples of a stream into motion frames of rs2_motion_sample,
+        // for the owning device to register. They apply from the next start
+        std::shared_ptr<option> get_batch_size_option() const { return _batch_size; }
+        std::shared_ptr<option> get_batch_period_option() const { return _batch_period; }
+
     protected:
         stream_profiles init_stream_profiles() override;
 
     private:
+        // Samples of a stream waiting for their batch to complete
+        struct motion_batch
+        {
+            std::vector<rs2_motion_sample> samples;
+            frame_additional_data additional_data;  // Of the first sample
+        };
+
         const std::map<rs2_stream, uint32_t> stream_and_fourcc = {{RS2_STREAM_GYRO,  rs_fourcc('G','Y','R','O')},
                                                                   {RS2_STREAM_ACCEL, rs_fourcc('A','C','C','L')},
                                                                   {RS2_STREAM_GPIO,  rs_fourcc('G','P','I','O')}};
@@ -244,6 +261,10 @@ namespace librealsense
         std::vector<platform::hid_sensor> _hid_sensors;
         std::unique_ptr<frame_timestamp_reader> _hid_iio_timestamp_reader;
         std::unique_ptr<frame_timestamp_reader> _custom_hid_timestamp_reader;
+        int _batch_size_value;
+        int _batch_period_value;
+        std::shared_ptr<option> _batch_size;
+        std::shared_ptr<option> _batch_period;
 
         stream_profiles get_sensor_profiles(std::string sensor_name) const;
 
@@ -254,6 +275,51 @@ namespace librealsense
         uint32_t fps_to_sampling_frequency(rs2_stream stream, uint32_t fps) const;
     };
 
+    // Values of the cacheable options of a sensor kept in memory, so that polling them does not cost a control transfer each.
+    // A set writes through and drops the other values, as the controls of a device may depend on one another.
+    // A value older than the refresh period is still served, while it is read again in the background, the options gone
+    // stale together being read by a single background task
+    class option_cache
+    {
+    public:
+        explicit option_cache(int refresh_ms = 1000);
+        ~option_cache();
+
+        // The values are read from the device every time until the cache is enabled
+        void enable();
+        // Stops the background reads, the cache reads from the device every time from then on
+        void stop();
+
+        // The value of opt, read when it is not cached. A control that is not cacheable is always read
+        float query(const option* opt, std::function<float()> read, bool cacheable = true);
+        void set(const option* opt, float value, std::function<void()> write);
+        void invalidate();
+
+        // While deferred, the reads of the calling thread the cache cannot serve are skipped and counted instead,
+        // so that a bulk read powers the device only for them
+        void defer_reads(bool defer);
+        int deferred_reads();
+
+    private:
+        struct entry
+        {
+            float value;
+            std::chrono::steady_clock::time_point read_time;
+            bool refreshing;
+        };
+
+        void refresh();
+
+        std::mutex _mutex;
+        std::map<const option*, entry> _values;
+        std::map<const option*, std::function<float()>> _stale;    // Options the next refresh reads
+        bool _refresh_queued;
+        uint64_t _generation;   // Moves on with every set, so that a read racing a set is not kept
+        int _refresh_ms;
+        std::map<std::thread::id, int> _deferred;  // Reads skipped per deferring thread
+        std::unique_ptr<dispatcher> _refresher;
+    };
+
     class uvc_sensor : public sensor_base
     {
     public:
@@ -269,6 +335,13 @@ namespace librealsense
         void register_pu(rs2_option id);
         void try_register_pu(rs2_option id);
 
+        option_cache& get_option_cache() { return _option_cache; }
+        // Reads the options with the device powered once for all of them
+        std::vector<float> query_options(const std::vector<rs2_option>& ids) const override;
+        // Reads options whose controls belong to this sensor, serving the cached values first and powering the device
+        // once for the others
+        std::vector<float> query_options_of(const options_interface& options, const std::vector<rs2_option>& ids);
+
         std::vector<platform::stream_profile> get_configuration() const { return _internal_config; }
         std::shared_ptr<platform::uvc_device> get_uvc_device() { return _device; }
         platform::usb_spec get_usb_specification() const { return _device->get_usb_specification(); }
@@ -325,6 +398,7 @@ namespace librealsense
         std::vector<platform::extension_unit> _xus;
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
+        option_cache _option_cache;
     };
 
     processing_blocks get_color_recommended_proccesing_blocks();
@@ -290,6 +290,17 @@ namespace librealsense
             CASE(LED_POWER)
             CASE(ZERO_ORDER_ENABLED)
             CASE(ENABLE_MAP_PRESERVATION)
+            CASE(SPARSE_OUTPUT)
+            CASE(VERTEX_FORMAT)
+            CASE(VERTEX_SCALE)
+            CASE(OCCLUSION_DECIMATION)
+            CASE(ROI_MIN_X)
+            CASE(ROI_MIN_Y)
+            CASE(ROI_MAX_X)
+            CASE(ROI_MAX_Y)
+            CASE(ROI_CROP)
+            CASE(MOTION_BATCH_SIZE)
+            CASE(MOTION_BATCH_PERIOD)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -328,6 +339,8 @@ namespace librealsense
             CASE(INZI)
             CASE(INVI)
             CASE(W10)
+            CASE(XYZ16)
+            CASE(XYZ16F)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
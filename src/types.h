@@ -1385,19 +1385,24 @@ namespace librealsense
     {
         std::function<void()> continuation;
         const void* protected_data = nullptr;
+        size_t protected_size = 0;
 
         frame_continuation(const frame_continuation &) = delete;
         frame_continuation & operator=(const frame_continuation &) = delete;
     public:
         frame_continuation() : continuation([]() {}) {}
 
-        explicit frame_continuation(std::function<void()> continuation, const void* protected_data) : continuation(continuation), protected_data(protected_data) {}
+        // protected_size is the size of protected_data when it holds the frame data, 0 otherwise
+        explicit frame_continuation(std::function<void()> continuation, const void* protected_data, size_t protected_size = 0)
+            : continuation(continuation), protected_data(protected_data), protected_size(protected_size) {}
 
 
-        frame_continuation(frame_continuation && other) : continuation(std::move(other.continuation)), protected_data(other.protected_data)
+        frame_continuation(frame_continuation && other)
+            : continuation(std::move(other.continuation)), protected_data(other.protected_data), protected_size(other.protected_size)
         {
             other.continuation = []() {};
             other.protected_data = nullptr;
+            other.protected_size = 0;
         }
 
         void operator()()
@@ -1405,23 +1410,28 @@ namespace librealsense
             continuation();
             continuation = []() {};
             protected_data = nullptr;
+            protected_size = 0;
         }
 
         void reset()
         {
             protected_data = nullptr;
+            protected_size = 0;
             continuation = [](){};
         }
 
         const void* get_data() const { return protected_data; }
+        size_t get_size() const { return protected_size; }
 
         frame_continuation & operator=(frame_continuation && other)
         {
             continuation();
             protected_data = other.protected_data;
+            protected_size = other.protected_size;
             continuation = other.continuation;
             other.continuation = []() {};
             other.protected_data = nullptr;
+            other.protected_size = 0;
             return *this;
         }
 
@@ -0,0 +1,182 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "uevent-device-watcher.h"
+#include "usb/usb-types.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace librealsense
+{
+    // The watcher waits for the events in slices, so that it stops promptly
+    static const int event_wait_ms = 100;
+    // The events of a burst arrive within the settle time of one another, this also leaves udev the time to
+    // set up the device nodes before the devices are queried
+    static const int settle_ms = 100;
+    static const int max_burst_ms = 2000;
+
+    static const uint16_t VID_MOVIDIUS = 0x03e7;
+
+    namespace platform
+    {
+        bool parse_uevent(const char* buf, size_t len, uevent& ev)
+        {
+            ev = uevent();
+
+            // The header is followed by the null separated properties
+            auto end = buf + len;
+            auto header_end = static_cast<const char*>(memchr(buf, 0, len));
+            if (!header_end)
+                return false;
+
+            std::string header(buf, header_end);
+            auto at = header.find('@');
+            if (at == std::string::npos || at == 0)
+                return false;
+            ev.action = header.substr(0, at);
+            ev.devpath = header.substr(at + 1);
+
+            for (auto p = header_end + 1; p < end;)
+            {
+                auto prop_end = static_cast<const char*>(memchr(p, 0, end - p));
+                if (!prop_end)
+                    prop_end = end;
+
+                std::string prop(p, prop_end);
+                auto eq = prop.find('=');
+                if (eq != std::string::npos)
+                    ev.properties[prop.substr(0, eq)] = prop.substr(eq + 1);
+                p = prop_end + 1;
+            }
+
+            auto it = ev.properties.find("SUBSYSTEM");
+            if (it != ev.properties.end())
+                ev.subsystem = it->second;
+            return true;
+        }
+    }
+
+    static std::string get_property(const platform::uevent& ev, const char* key)
+    {
+        auto it = ev.properties.find(key);
+        return it != ev.properties.end() ? it->second : "";
+    }
+
+    static bool is_camera_vid(unsigned long vid)
+    {
+        return vid == VID_INTEL_CAMERA || vid == VID_MOVIDIUS;
+    }
+
+    int uevent_device_watcher::affected_lists(const platform::uevent& ev)
+    {
+        if (ev.action == "resync")
+            return uvc_list | usb_list | hid_list;
+        if (ev.action != "add" && ev.action != "remove")
+            return 0;
+
+        if (ev.subsystem == "video4linux")
+            return uvc_list;
+
+        if (ev.subsystem == "usb")
+        {
+            // PRODUCT is vid/pid/bcd in hex, the interfaces of a device are reported with the device itself
+            if (get_property(ev, "DEVTYPE") != "usb_device")
+                return 0;
+            auto product = get_property(ev, "PRODUCT");
+            return is_camera_vid(strtoul(product.c_str(), nullptr, 16)) ? usb_list : 0;
+        }
+
+        if (ev.subsystem == "hid")
+        {
+            // HID_ID is bus:vid:pid in hex
+            auto id = get_property(ev, "HID_ID");
+            auto colon = id.find(':');
+            if (colon == std::string::npos)
+                return 0;
+            return is_camera_vid(strtoul(id.c_str() + colon + 1, nullptr, 16)) ? hid_list : 0;
+        }
+
+        // The iio devices and the hidraw nodes carry no vendor, the backend filters them when queried
+        if (ev.subsystem == "iio" || ev.subsystem == "hidraw")
+            return hid_list;
+
+        return 0;
+    }
+
+    uevent_device_watcher::uevent_device_watcher(const platform::backend* backend_ref, std::shared_ptr<platform::uevent_source> source)
+        : _backend(backend_ref), _source(std::move(source)),
+        _active_object([this](dispatcher::cancellable_timer cancellable_timer)
+        {
+            watch(cancellable_timer);
+        }), _devices_data()
+    {
+    }
+
+    uevent_device_watcher::~uevent_device_watcher()
+    {
+        stop();
+    }
+
+    void uevent_device_watcher::watch(dispatcher::cancellable_timer cancellable_timer)
+    {
+        platform::uevent ev;
+        if (!_source->next(ev, event_wait_ms))
+            return;
+
+        int lists = affected_lists(ev);
+        if (!lists)
+            return;
+
+        // Gather the rest of the burst, bounded for a source that never settles
+        using namespace std::chrono;
+        auto burst_end = steady_clock::now() + milliseconds(max_burst_ms);
+        while (steady_clock::now() < burst_end && _source->next(ev, settle_ms))
+            lists |= affected_lists(ev);
+
+        if (cancellable_timer.try_sleep(0))
+            update(lists);
+    }
+
+    void uevent_device_watcher::update(int lists)
+    {
+        platform::backend_device_group curr = _devices_data;
+        if (lists & uvc_list)
+            curr.uvc_devices = _backend->query_uvc_devices();
+        if (lists & usb_list)
+            curr.usb_devices = _backend->query_usb_devices();
+        if (lists & hid_list)
+            curr.hid_devices = _backend->query_hid_devices();
+
+        if (list_changed(_devices_data.uvc_devices, curr.uvc_devices) ||
+            list_changed(_devices_data.usb_devices, curr.usb_devices) ||
+            list_changed(_devices_data.hid_devices, curr.hid_devices))
+        {
+            callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
+            if (callback)
+            {
+                _callback(_devices_data, curr);
+                _devices_data = curr;
+            }
+        }
+    }
+
+    void uevent_device_watcher::start(platform::device_changed_callback callback)
+    {
+        stop();
+        _callback = std::move(callback);
+        _devices_data = { _backend->query_uvc_devices(),
+                          _backend->query_usb_devices(),
+                          _backend->query_hid_devices() };
+
+        _active_object.start();
+    }
+
+    void uevent_device_watcher::stop()
+    {
+        _active_object.stop();
+
+        _callback_inflight.wait_until_empty();
+    }
+}
@@ -0,0 +1,75 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "backend.h"
+#include "types.h"
+
+#include <map>
+#include <string>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Kernel object event, as broadcast by the kernel to the NETLINK_KOBJECT_UEVENT sockets
+        struct uevent
+        {
+            std::string action;     // add, remove, change, bind, unbind...
+            std::string subsystem;
+            std::string devpath;
+            std::map<std::string, std::string> properties;
+        };
+
+        // Parses an "action@devpath\0KEY=VALUE\0..." kernel message, false when buf is not one
+        bool parse_uevent(const char* buf, size_t len, uevent& ev);
+
+        // Source of the kernel object events, the netlink socket on Linux and a fake one in the tests.
+        // A source that lost events, such as on a receive buffer overrun, reports an event of action resync,
+        // so that the watcher queries all the devices again
+        class uevent_source
+        {
+        public:
+            // Waits up to timeout_ms for the next event, false when none arrived
+            virtual bool next(uevent& ev, int timeout_ms) = 0;
+            virtual ~uevent_source() {}
+        };
+    }
+
+    // Device watcher reacting to the kernel add and remove events of the cameras instead of polling.
+    // The events of a burst, such as all the nodes of a camera being plugged, are coalesced and only the device
+    // lists they affect are queried again from the backend, the other lists of the device group are kept as is
+    class uevent_device_watcher : public platform::device_watcher
+    {
+    public:
+        uevent_device_watcher(const platform::backend* backend_ref, std::shared_ptr<platform::uevent_source> source);
+        ~uevent_device_watcher();
+
+        void start(platform::device_changed_callback callback) override;
+        void stop() override;
+
+        enum device_list
+        {
+            uvc_list = 1,
+            usb_list = 2,
+            hid_list = 4,
+        };
+
+        // The device lists an event affects, 0 for the events of the other devices and of the other actions
+        static int affected_lists(const platform::uevent& ev);
+
+    private:
+        void watch(dispatcher::cancellable_timer cancellable_timer);
+        void update(int lists);
+
+        const platform::backend* _backend;
+        std::shared_ptr<platform::uevent_source> _source;
+
+        active_object<> _active_object;
+        callbacks_heap _callback_inflight;
+
+        platform::backend_device_group _devices_data;
+        platform::device_changed_callback _callback;
+    };
+}
@@ -65,6 +65,9 @@ namespace librealsense
             virtual std::string get_device_location() const override;
             virtual usb_spec  get_usb_specification() const override;
 
+            // The streamers hand their read buffers over to the frames
+            virtual bool retains_frame_buffers() const override { return true; }
+
         private:
             friend class source_reader_callback;
 
@@ -7,6 +7,9 @@
 const int UVC_PAYLOAD_MAX_HEADER_LENGTH         = 1024;
 const int DEQUEUE_MILLISECONDS_TIMEOUT          = 50;
 const int ENDPOINT_RESET_MILLISECONDS_TIMEOUT   = 100;
+const int REQUESTS_MILLISECONDS_WINDOW          = 30;               // Frames the requests in flight cover
+const uint32_t REQUESTS_MAX_IN_FLIGHT           = 16;
+const size_t REQUESTS_MAX_IN_FLIGHT_BYTES       = 64 * 1024 * 1024;
 
 void cleanup_frame(backend_frame *ptr) {
     if (ptr) ptr->owner->deallocate(ptr);
@@ -16,6 +19,37 @@ namespace librealsense
 {
     namespace platform
     {
+        uint32_t uvc_request_depth(uint32_t max_frame_size, uint32_t fps, uint32_t minimum)
+        {
+            // One request more than the frames of the window, for the request being resubmitted
+            uint32_t depth = (fps * REQUESTS_MILLISECONDS_WINDOW + 999) / 1000 + 1;
+            auto frame_size = std::max<size_t>(max_frame_size + UVC_PAYLOAD_MAX_HEADER_LENGTH, 1);
+            depth = std::min<uint32_t>(depth, static_cast<uint32_t>(REQUESTS_MAX_IN_FLIGHT_BYTES / frame_size));
+            depth = std::min(depth, REQUESTS_MAX_IN_FLIGHT);
+            return std::max(depth, std::max(minimum, 1u));
+        }
+
+        std::vector<uint8_t> uvc_buffer_pool::acquire()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_spare.empty())
+                {
+                    auto buffer = std::move(_spare.back());
+                    _spare.pop_back();
+                    return buffer;
+                }
+            }
+            return std::vector<uint8_t>(_length);
+        }
+
+        void uvc_buffer_pool::release(std::vector<uint8_t> buffer)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (buffer.size() == _length)
+                _spare.push_back(std::move(buffer));
+        }
+
         uvc_streamer::uvc_streamer(uvc_streamer_context context) :
             _context(context), _action_dispatcher(10)
         {
@@ -25,7 +59,13 @@ namespace librealsense
             _read_endpoint = inf->first_endpoint(platform::RS2_USB_ENDPOINT_DIRECTION_READ);
 
             _read_buff_length = UVC_PAYLOAD_MAX_HEADER_LENGTH + _context.control->dwMaxVideoFrameSize;
-            LOG_INFO("endpoint " << (int)_read_endpoint->get_address() << " read buffer size: " << _read_buff_length);
+            _context.request_count = static_cast<uint8_t>(uvc_request_depth(_context.control->dwMaxVideoFrameSize,
+                _context.profile.fps, _context.request_count));
+            LOG_INFO("endpoint " << (int)_read_endpoint->get_address() << " read buffer size: " << _read_buff_length
+                << ", requests in flight: " << (int)_context.request_count);
+
+            _stats = {};
+            _stats.requests_in_flight = _context.request_count;
 
             _action_dispatcher.start();
 
@@ -86,13 +126,27 @@ namespace librealsense
                 _frames_archive->deallocate(ptr);
             }
 
+            _buffer_pool = std::make_shared<uvc_buffer_pool>(_read_buff_length);
+
             _publish_frame_thread = std::make_shared<active_object<>>([this](dispatcher::cancellable_timer cancellable_timer)
             {
                 backend_frame_ptr fp(nullptr, [](backend_frame *) {});
                 if (_queue.dequeue(&fp, DEQUEUE_MILLISECONDS_TIMEOUT))
                 {
                     if(_publish_frames && running())
-                        _context.user_cb(_context.profile, fp->fo, []() mutable {});
+                    {
+                        // The frame data moves to the user along with its buffer, which returns to the pool once
+                        // released. The backend frame gets a spare buffer and goes back to the archive right away
+                        auto pool = _buffer_pool;
+                        auto pixels = std::make_shared<std::vector<uint8_t>>(std::move(fp->pixels));
+                        fp->pixels = pool->acquire();
+                        _context.user_cb(_context.profile, fp->fo, [pool, pixels]() mutable
+                        {
+                            if (pixels)
+                                pool->release(std::move(*pixels));
+                            pixels.reset();
+                        });
+                    }
                 }
             });
 
@@ -106,35 +160,18 @@ namespace librealsense
                        LOG_ERROR("uvc streamer watchdog triggered on endpoint: " << (int)_read_endpoint->get_address());
                        _context.messenger->reset_endpoint(_read_endpoint, ENDPOINT_RESET_MILLISECONDS_TIMEOUT);
                        _frame_arrived = false;
+
+                       std::lock_guard<std::mutex> lock(_stats_mutex);
+                       ++_stats.watchdog_resets;
                    });
              }, _watchdog_timeout);
 
             _watchdog->start();
 
+            // Completions are processed on the thread of the USB events, stop() cancels the callback before the requests
             _request_callback = std::make_shared<usb_request_callback>([this](platform::rs_usb_request r)
             {
-                _action_dispatcher.invoke([this, r](dispatcher::cancellable_timer c)
-                {
-                    if(!_running)
-                      return;
-
-                    auto al = r->get_actual_length();
-                    if(al > 0 && al == r->get_buffer().data()[0] + _context.control->dwMaxVideoFrameSize)
-                    {
-                        auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
-                        if(f)
-                        {
-                            _frame_arrived = true;
-                            _watchdog->kick();
-                            memcpy(f->pixels.data(), r->get_buffer().data(), r->get_buffer().size());
-                            uvc_process_bulk_payload(std::move(f), r->get_actual_length(), _queue);
-                        }
-                    }
-
-                    auto sts = _context.messenger->submit_request(r);
-                    if(sts != platform::RS2_USB_STATUS_SUCCESS)
-                        LOG_ERROR("failed to submit UVC request, error: " << sts);
-                });
+                on_request_completed(r);
             });
 
             _requests = std::vector<rs_usb_request>(_context.request_count);
@@ -146,6 +183,52 @@ namespace librealsense
             }
         }
 
+        void uvc_streamer::on_request_completed(rs_usb_request r)
+        {
+            if(!_running)
+                return;
+
+            auto completed = std::chrono::steady_clock::now();
+            bool delivered = false;
+
+            auto al = r->get_actual_length();
+            if(al > 0 && al == r->get_buffer().data()[0] + _context.control->dwMaxVideoFrameSize)
+            {
+                auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
+                if(f)
+                {
+                    _frame_arrived = true;
+                    _watchdog->kick();
+                    // The payload stays in place, the request is resubmitted with the former buffer of the frame
+                    if (f->pixels.size() == r->get_buffer().size())
+                        r->swap_buffer(f->pixels);
+                    else
+                        memcpy(f->pixels.data(), r->get_buffer().data(), std::min(f->pixels.size(), r->get_buffer().size()));
+                    uvc_process_bulk_payload(std::move(f), al, _queue);
+                    delivered = true;
+                }
+            }
+
+            auto sts = _context.messenger->submit_request(r);
+            if(sts != platform::RS2_USB_STATUS_SUCCESS)
+                LOG_ERROR("failed to submit UVC request, error: " << sts);
+
+            auto latency = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - completed).count();
+
+            std::lock_guard<std::mutex> lock(_stats_mutex);
+            if (delivered)
+            {
+                ++_stats.frames;
+                _stats.bytes += al;
+            }
+            else
+                ++_stats.dropped;
+
+            auto completions = _stats.frames + _stats.dropped;
+            _stats.mean_resubmit_latency_us += (latency - _stats.mean_resubmit_latency_us) / completions;
+            _stats.max_resubmit_latency_us = std::max(_stats.max_resubmit_latency_us, latency);
+        }
+
         void uvc_streamer::start()
         {
             _action_dispatcher.invoke_and_wait([this](dispatcher::cancellable_timer c)
@@ -166,7 +249,7 @@ namespace librealsense
 
                 _publish_frame_thread->start();
 
-            }, [this](){ return _running; });
+            }, [this](){ return _running.load(); });
         }
 
         void uvc_streamer::stop()
@@ -197,7 +280,17 @@ namespace librealsense
 
                 _running = false;
 
-            }, [this](){ return !_running; });
+                uvc_streamer_stats stats;
+                {
+                    std::lock_guard<std::mutex> lock(_stats_mutex);
+                    stats = _stats;
+                }
+                LOG_INFO("endpoint " << (int)_read_endpoint->get_address() << " streamed " << stats.frames << " frames, "
+                    << stats.bytes << " bytes, dropped " << stats.dropped << " requests with " << stats.requests_in_flight
+                    << " in flight, resubmit latency mean " << stats.mean_resubmit_latency_us << "us max "
+                    << stats.max_resubmit_latency_us << "us, watchdog resets " << stats.watchdog_resets);
+
+            }, [this](){ return !_running.load(); });
         }
 
         void uvc_streamer::flush()
@@ -211,6 +304,7 @@ namespace librealsense
             _request_callback.reset();
 
             _frames_archive.reset();
+            _buffer_pool.reset();
 
             _action_dispatcher.stop();
         }
@@ -11,6 +11,9 @@
 #include <string>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <vector>
+#include <atomic>
 
 typedef void(uvc_frame_callback_t)(struct librealsense::platform::frame_object *frame, void *user_ptr);
 
@@ -28,6 +31,40 @@ namespace librealsense
             uint8_t request_count;
         };
 
+        // Counters of the endpoint of a streamer since it started, logged when it stops
+        struct uvc_streamer_stats
+        {
+            uint32_t requests_in_flight;
+            unsigned long long frames;
+            unsigned long long bytes;
+            unsigned long long dropped;             // Completed requests not delivered as a frame
+            double mean_resubmit_latency_us;        // From the request completion to its resubmission
+            double max_resubmit_latency_us;
+            unsigned long long watchdog_resets;
+        };
+
+        // Number of bulk requests to keep in flight for a stream of the given frame size and rate. Every request
+        // receives a whole frame, the frames arriving while completed requests wait to be resubmitted need requests
+        // of their own: enough for the frames of a few milliseconds, within a bound on the memory kept in flight
+        uint32_t uvc_request_depth(uint32_t max_frame_size, uint32_t fps, uint32_t minimum);
+
+        // Spare read buffers of a streamer. The frames delivered to the user take their buffer along, the buffer
+        // comes back once the frame is released, possibly after the streamer is gone
+        class uvc_buffer_pool
+        {
+        public:
+            uvc_buffer_pool(size_t length) : _length(length) {}
+
+            // A spare buffer, a new one when none is left
+            std::vector<uint8_t> acquire();
+            void release(std::vector<uint8_t> buffer);
+
+        private:
+            std::mutex _mutex;
+            size_t _length;
+            std::vector<std::vector<uint8_t>> _spare;
+        };
+
         class uvc_streamer
         {
         public:
@@ -44,10 +81,13 @@ namespace librealsense
             bool wait_for_first_frame(uint32_t timeout_ms);
 
         private:
-            bool _running = false;
-            bool _frame_arrived = false;
+            std::atomic<bool> _running{ false };
+            std::atomic<bool> _frame_arrived{ false };
             bool _publish_frames = true;
 
+            std::mutex _stats_mutex;
+            uvc_streamer_stats _stats;
+
             int64_t _watchdog_timeout;
             uvc_streamer_context _context;
 
@@ -59,11 +99,13 @@ namespace librealsense
             rs_usb_endpoint _read_endpoint;
             std::vector<rs_usb_request> _requests;
             std::shared_ptr<backend_frames_archive> _frames_archive;
+            std::shared_ptr<uvc_buffer_pool> _buffer_pool;
             std::shared_ptr<active_object<>> _publish_frame_thread;
             std::shared_ptr<platform::usb_request_callback> _request_callback;
 
             void init();
             void flush();
+            void on_request_completed(rs_usb_request r);
         };
     }
 }
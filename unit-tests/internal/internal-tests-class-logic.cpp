@@ -2,9 +2,27 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include "catch/catch.hpp"
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <random>
+#include <librealsense2/rsutil.h>
 #include "./../src/api.h"
+#include "./../src/concurrency.h"
+#include "./../src/proc/deprojection-map-cache.h"
+#include "./../src/proc/pointcloud.h"
+#include "./../src/proc/occlusion-filter.h"
+#include "./../src/proc/colorizer.h"
+#include "./../src/proc/align.h"
+#include "./../src/proc/motion-transform.h"
+#include "./../src/stream.h"
+#include "./../src/uevent-device-watcher.h"
+#if defined(RS2_USE_LIBUVC_BACKEND) || defined(RS2_USE_ANDROID_BACKEND) || defined(RS2_USE_WINUSB_UVC_BACKEND)
+#include "./../src/uvc/uvc-streamer.h"
+#endif
 
 TEST_CASE("verify_version_compatibility", "[code]")
 {
@@ -43,3 +61,824 @@ TEST_CASE("verify_version_compatibility", "[code]")
         REQUIRE_NOTHROW(verify_version_compatibility(base+i));
     }
 }
+
+TEST_CASE("thread_pool parallel_for covers the range exactly once", "[code]")
+{
+    thread_pool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    std::vector<int> hits(10007, 0);
+    for (int i = 0; i < 10; i++)
+        pool.parallel_for(0, (int)hits.size(), [&](int first, int last)
+        {
+            for (int j = first; j < last; j++) hits[j]++;
+        }, 64);
+    for (auto h : hits)
+        REQUIRE(h == 10);
+
+    // Nested calls must complete even when every worker is busy
+    std::atomic<int> total{ 0 };
+    pool.parallel_for(0, 16, [&](int first, int last)
+    {
+        pool.parallel_for(0, 100, [&](int a, int b) { total += b - a; });
+    });
+    REQUIRE(total == 16 * 100);
+
+    REQUIRE_THROWS(pool.parallel_for(0, 100, [](int first, int last)
+    {
+        if (last == 100) throw std::runtime_error("range failure");
+    }));
+}
+
+namespace librealsense
+{
+    // Reaches the colorizer's two ways of coloring Z16, the look-up table and the per-pixel mapping it replaced
+    class colorizer_under_test : public colorizer
+    {
+    public:
+        int map_count() const { return (int)_maps.size(); }
+
+        void configure(int map_index, float min, float max, float depth_units)
+        {
+            _map_index = map_index;
+            _min = min;
+            _max = max;
+            _depth_units = depth_units;
+        }
+
+        void colorize_with_lut(const uint16_t* depth, uint8_t* rgb, int w, int h, bool equalize)
+        {
+            if (equalize)
+            {
+                update_histogram(_hist_data, depth, w, h);
+                update_equalized_lut();
+            }
+            else
+                update_fixed_lut();
+            make_rgb_data_lut(depth, rgb, w, h);
+        }
+
+        void colorize_per_pixel(const uint16_t* depth, uint8_t* rgb, int w, int h, bool equalize)
+        {
+            if (equalize)
+            {
+                update_histogram(_hist_data, depth, w, h);
+                make_rgb_data<uint16_t>(depth, rgb, w, h, [this](float data) {
+                    return _hist_data[(int)data] / (float)_hist_data[MAX_DEPTH - 1];
+                });
+            }
+            else
+                make_rgb_data<uint16_t>(depth, rgb, w, h, [this](float data) {
+                    return (data * _depth_units - _min) / (_max - _min);
+                });
+        }
+    };
+}
+
+TEST_CASE("Colorizer look-up table matches the per-pixel colors", "[code]")
+{
+    using namespace librealsense;
+
+    // A VGA frame with holes, ramps across the range and values beyond it, up to the largest Z16 value
+    const int width = 640, height = 480;
+    std::vector<uint16_t> depth(width * height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+        {
+            auto i = y * width + x;
+            depth[i] = (i % 17 == 0) ? 0 : uint16_t(y * 40 + x * 7 + (i * 2654435761u >> 24));
+        }
+    depth[1] = 0xffff;
+    depth[2] = 1;
+
+    std::vector<uint8_t> with_lut(width * height * 3), per_pixel(width * height * 3);
+    colorizer_under_test lut_colorizer, pixel_colorizer;
+    for (int map_index = 0; map_index < lut_colorizer.map_count(); map_index++)
+    {
+        for (bool equalize : { true, false })
+        {
+            CAPTURE(map_index);
+            CAPTURE(equalize);
+            // The fixed table is rebuilt when the range or the depth units change
+            for (auto range : { std::make_pair(0.f, 6.f), std::make_pair(0.3f, 1.5f) })
+            {
+                for (float depth_units : { 0.001f, 0.0001f })
+                {
+                    lut_colorizer.configure(map_index, range.first, range.second, depth_units);
+                    pixel_colorizer.configure(map_index, range.first, range.second, depth_units);
+                    lut_colorizer.colorize_with_lut(depth.data(), with_lut.data(), width, height, equalize);
+                    pixel_colorizer.colorize_per_pixel(depth.data(), per_pixel.data(), width, height, equalize);
+                    REQUIRE(with_lut == per_pixel);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+    // Depth aligned to a color stream through the scalar align stages
+    struct align_inputs
+    {
+        rs2_intrinsics depth_intrin;
+        rs2_intrinsics color_intrin;
+        rs2_extrinsics depth_to_color{ { 0.9999f, 0.0012f, -0.0095f, -0.0012f, 1.f, 0.0011f, 0.0095f, -0.0011f, 0.9999f },{ 0.0147f, 0.0002f, 0.0003f } };
+        float depth_scale = 0.001f;
+
+        std::vector<uint16_t> depth;
+        std::vector<uint8_t> color;
+
+        align_inputs(int depth_width, int depth_height, int color_width, int color_height)
+        {
+            depth_intrin = { depth_width, depth_height, depth_width / 2.f + 0.3f, depth_height / 2.f - 2.2f, depth_width * 0.5f, depth_width * 0.5f,
+                RS2_DISTORTION_BROWN_CONRADY,{ 0, 0, 0, 0, 0 } };
+            color_intrin = { color_width, color_height, color_width / 2.f + 1.2f, color_height / 2.f + 5.7f, color_width * 0.72f, color_width * 0.72f,
+                RS2_DISTORTION_INVERSE_BROWN_CONRADY,{ 0.01f, -0.02f, 0.001f, 0.002f, 0.f } };
+
+            // Near objects in front of a far background, so that footprints of different depth rows overlap
+            std::mt19937 gen(1234);
+            std::uniform_int_distribution<int> noise(0, 200);
+            depth.resize(depth_width * depth_height);
+            for (int y = 0; y < depth_height; ++y)
+                for (int x = 0; x < depth_width; ++x)
+                {
+                    auto i = y * depth_width + x;
+                    bool near = (x / 40 + y / 30) % 3 == 0;
+                    auto d = (near ? 400 : 3000) + noise(gen);
+                    depth[i] = (noise(gen) < 15) ? 0 : uint16_t(d);
+                }
+
+            color.resize(color_width * color_height * 3);
+            for (size_t i = 0; i < color.size(); ++i)
+                color[i] = uint8_t(i * 31 + i / 7);
+        }
+    };
+
+    // The serial loop the thread pool stages replaced, transferring every pixel of every footprint in order
+    template<class TRANSFER>
+    void serial_align(const align_inputs& in, TRANSFER transfer)
+    {
+        auto&& depth_intrin = in.depth_intrin;
+        auto&& other_intrin = in.color_intrin;
+        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        {
+            int depth_pixel_index = depth_y * depth_intrin.width;
+            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            {
+                if (float depth = in.depth_scale * in.depth[depth_pixel_index])
+                {
+                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
+                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                    rs2_transform_point_to_point(other_point, &in.depth_to_color, depth_point);
+                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                    const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
+                    const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
+                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                    rs2_transform_point_to_point(other_point, &in.depth_to_color, depth_point);
+                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                    const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
+                    const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                    if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                        continue;
+
+                    for (int y = other_y0; y <= other_y1; ++y)
+                        for (int x = other_x0; x <= other_x1; ++x)
+                            transfer(depth_pixel_index, y * other_intrin.width + x);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Scalar align matches the serial computation on any number of threads", "[code]")
+{
+    using namespace librealsense;
+
+    // Color of a higher resolution than depth, and of a lower one where many depth pixels share a color pixel
+    for (auto sizes : { std::make_pair(640, 1280), std::make_pair(640, 424) })
+    {
+        CAPTURE(sizes.second);
+        align_inputs in(sizes.first, sizes.first * 3 / 4, sizes.second, sizes.second * 9 / 16);
+        auto depth_size = in.depth.size();
+        auto color_size = in.color.size() / 3;
+
+        std::vector<uint16_t> expected_z(color_size, 0);
+        serial_align(in, [&](int depth_index, int color_index)
+        {
+            auto z = in.depth[depth_index];
+            expected_z[color_index] = expected_z[color_index] ? std::min(expected_z[color_index], z) : z;
+        });
+        std::vector<uint8_t> expected_color(depth_size * 3, 0);
+        serial_align(in, [&](int depth_index, int color_index)
+        {
+            std::copy_n(&in.color[color_index * 3], 3, &expected_color[depth_index * 3]);
+        });
+        REQUIRE(std::count(expected_z.begin(), expected_z.end(), 0) < (long)color_size / 2);
+
+        for (unsigned int threads : { 1u, 2u, 3u, 8u })
+        {
+            CAPTURE(threads);
+            thread_pool pool(threads);
+            align_map map;
+            map_depth_to_other(in.depth_intrin, in.depth_to_color, in.color_intrin, in.depth.data(), in.depth_scale, map, pool);
+
+            std::vector<uint16_t> z(color_size, 0);
+            splat_depth_to_other(in.depth.data(), z.data(), in.depth_intrin, in.color_intrin, map, pool);
+            REQUIRE(z == expected_z);
+
+            std::vector<uint8_t> color(depth_size * 3, 0);
+            align_other_to_depth(color.data(), in.depth_intrin, in.color_intrin, in.color.data(), RS2_FORMAT_RGB8, map, pool);
+            REQUIRE(color == expected_color);
+        }
+    }
+}
+
+TEST_CASE("Scalar align throughput by the number of threads", "[.][benchmark]")
+{
+    using namespace librealsense;
+    using namespace std::chrono;
+
+    align_inputs in(1280, 720, 1920, 1080);
+    const int iterations = 50;
+    std::vector<uint16_t> z(in.color.size() / 3);
+    std::vector<uint8_t> color(in.depth.size() * 3);
+
+    std::cout << "1280x720 depth to 1920x1080 color, " << iterations << " frames" << std::endl;
+    auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 2)
+    {
+        thread_pool pool(threads);
+        align_map map;
+        double totals[2] = {};
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto t0 = high_resolution_clock::now();
+            map_depth_to_other(in.depth_intrin, in.depth_to_color, in.color_intrin, in.depth.data(), in.depth_scale, map, pool);
+            std::fill(z.begin(), z.end(), 0);
+            splat_depth_to_other(in.depth.data(), z.data(), in.depth_intrin, in.color_intrin, map, pool);
+            auto t1 = high_resolution_clock::now();
+            map_depth_to_other(in.depth_intrin, in.depth_to_color, in.color_intrin, in.depth.data(), in.depth_scale, map, pool);
+            align_other_to_depth(color.data(), in.depth_intrin, in.color_intrin, in.color.data(), RS2_FORMAT_RGB8, map, pool);
+            auto t2 = high_resolution_clock::now();
+            totals[0] += duration<double>(t1 - t0).count();
+            totals[1] += duration<double>(t2 - t1).count();
+        }
+        std::cout << threads << " threads"
+            << "\tdepth to color: " << iterations / totals[0] << " fps"
+            << "\tcolor to depth: " << iterations / totals[1] << " fps" << std::endl;
+    }
+}
+
+TEST_CASE("deprojection_map_cache shares maps and evicts unused ones", "[code]")
+{
+    using namespace librealsense;
+
+    deprojection_map_cache cache(1);
+    rs2_intrinsics a{ 64, 48, 32.f, 24.f, 50.f, 50.f, RS2_DISTORTION_INVERSE_BROWN_CONRADY,{ 0.1f, -0.05f, 0.001f, 0.002f, 0.f } };
+    rs2_intrinsics b = a;
+    b.model = RS2_DISTORTION_NONE;
+
+    auto map_a = cache.get(a);
+    REQUIRE(map_a->x.size() == 64 * 48);
+    REQUIRE(cache.get(a) == map_a);                 // Same intrinsics and offset share one map
+    REQUIRE(cache.get(a, 0.5f) != map_a);           // Pixel corners are a different map
+    REQUIRE(cache.get(b) != map_a);                 // So is a different distortion model
+
+    auto built = deprojection_map_cache::build(a, 0.f);
+    REQUIRE(built.x == map_a->x);
+    REQUIRE(built.y == map_a->y);
+
+    auto stats = cache.get_stats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 3);
+    // (a, 0.5) went unused when (b, 0) was added, with room for a single unused map it stays
+    REQUIRE(stats.entries == 3);
+    REQUIRE(stats.in_use == 1);
+    REQUIRE(stats.bytes == 3 * 2 * 64 * 48 * sizeof(float));
+
+    // Adding another map evicts the least recently used unreferenced one, never a referenced one
+    rs2_intrinsics c = b;
+    c.fx = 60.f;
+    cache.get(c);
+    stats = cache.get_stats();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.entries == 3);
+    REQUIRE(cache.get(a) == map_a);
+    REQUIRE(cache.get(c) != nullptr);
+    REQUIRE(cache.get_stats().misses == 4);
+
+    map_a.reset();
+    cache.set_capacity(0);
+    stats = cache.get_stats();
+    REQUIRE(stats.entries == 0);
+    REQUIRE(stats.bytes == 0);
+}
+
+TEST_CASE("find_valid_pixels compacts the non-zero depth indices", "[code]")
+{
+    // Sizes around the 8-pixel SIMD block, plus a full frame
+    for (size_t size : { 0, 1, 7, 8, 9, 17, 640 * 480 + 3 })
+    {
+        std::vector<uint16_t> depth(size);
+        for (size_t i = 0; i < size; ++i)
+            depth[i] = (i % 3 == 0 || i % 7 == 0) ? 0 : uint16_t(i % 5000 + 1);
+
+        std::vector<int> expected;
+        for (size_t i = 0; i < size; ++i)
+            if (depth[i]) expected.push_back(int(i));
+
+        std::vector<int> valid;
+        auto count = librealsense::find_valid_pixels(depth.data(), size, valid);
+        REQUIRE(count == expected.size());
+        valid.resize(count);
+        REQUIRE(valid == expected);
+    }
+}
+
+TEST_CASE("Exhaustive occlusion keeps the nearest point of every texel", "[code]")
+{
+    using namespace librealsense;
+
+    // Depth spanning many bands of lines, with points of distant lines mapped to the same texels of a 16x16 texture
+    const int width = 64, height = 200, size = width * height;
+    rs2_intrinsics depth_intrin{ width, height, 0, 0, 1, 1, RS2_DISTORTION_NONE,{ 0, 0, 0, 0, 0 } };
+    rs2_intrinsics texel_intrin{ 16, 16, 0, 0, 1, 1, RS2_DISTORTION_NONE,{ 0, 0, 0, 0, 0 } };
+
+    std::vector<float3> points(size);
+    std::vector<float2> pixels(size);
+    for (int i = 0; i < size; ++i)
+    {
+        points[i] = { 0.f, 0.f, (i % 29 == 0) ? 0.f : 1.f + (i % 7) * 0.03f + (i / width % 5) * 0.02f };
+        pixels[i] = { 0.5f + (i % 13), 0.5f + (i / width * 3 + i) % 11 };
+    }
+
+    for (uint8_t decimation : { 1, 4 })
+    {
+        CAPTURE(decimation);
+        occlusion_filter filter;
+        filter.set_mode(occlusion_exhaustic_search);
+        filter.set_depth_intrinsics(depth_intrin);
+        filter.set_texel_intrinsics(texel_intrin);
+        filter.set_texel_decimation(decimation);
+
+        std::vector<float2> uv(size, { 0.5f, 0.5f });
+        filter.process(points.data(), uv.data(), pixels);
+
+        // Serial reference: minimal depth per texel cell, points farther than it by more than the threshold are invalidated
+        std::map<int, float> min_depth;
+        auto cell = [&](int i) { return int(pixels[i].y) / decimation * 16 + int(pixels[i].x) / decimation; };
+        for (int i = 0; i < size; ++i)
+        {
+            if (!points[i].z) continue;
+            auto it = min_depth.find(cell(i));
+            if (it == min_depth.end() || points[i].z < it->second) min_depth[cell(i)] = points[i].z;
+        }
+        int invalidated = 0;
+        for (int i = 0; i < size; ++i)
+        {
+            bool occluded = points[i].z && min_depth[cell(i)] + 0.05f < points[i].z;
+            REQUIRE((uv[i].x == 0.f && uv[i].y == 0.f) == occluded);
+            invalidated += occluded;
+        }
+        REQUIRE(invalidated > 0);
+
+        // Every line of the frame takes part, not only the lines of the first band
+        REQUIRE(std::any_of(uv.begin() + (height - 1) * width, uv.end(), [](const float2& t) { return t.x == 0.f && t.y == 0.f; }));
+    }
+}
+
+TEST_CASE("Heuristic occlusion scans every line as the serial scan does", "[code]")
+{
+    using namespace librealsense;
+
+    const int width = 64, height = 200, size = width * height;
+    rs2_intrinsics depth_intrin{ width, height, 0, 0, 1, 1, RS2_DISTORTION_NONE,{ 0, 0, 0, 0, 0 } };
+    rs2_intrinsics texel_intrin{ 16, 16, 0, 0, 1, 1, RS2_DISTORTION_NONE,{ 0, 0, 0, 0, 0 } };
+
+    std::vector<float3> points(size);
+    std::vector<float2> pixels(size);
+    for (int i = 0; i < size; ++i)
+    {
+        points[i] = { 0.f, 0.f, (i % 29 == 0) ? 0.f : 1.f + (i % 7) * 0.03f };
+        pixels[i] = { 0.5f + (i % 13 + i / width) % 16, 0.5f + (i / width) % 16 };
+    }
+
+    occlusion_filter filter;
+    filter.set_mode(occlusion_monotonic_scan);
+    filter.set_depth_intrinsics(depth_intrin);
+    filter.set_texel_intrinsics(texel_intrin);
+
+    std::vector<float2> uv(size, { 0.5f, 0.5f });
+    filter.process(points.data(), uv.data(), pixels);
+
+    // Serial reference: a texel left of the rightmost one seen so far on the line is occluded, so is the point following it
+    std::vector<float2> expected(size, { 0.5f, 0.5f });
+    for (int y = 0; y < height; ++y)
+    {
+        float max_in_line = -1, max_z = 0;
+        int dilation_left = 0;
+        for (int x = 0; x < width; ++x)
+        {
+            auto i = y * width + x;
+            if (!points[i].z) continue;
+            if (pixels[i].x < max_in_line || (pixels[i].x == max_in_line && points[i].z - max_z > 0.1f))
+            {
+                expected[i] = { 0.f, 0.f };
+                dilation_left = 1;
+            }
+            else
+            {
+                max_in_line = pixels[i].x;
+                max_z = points[i].z;
+                if (dilation_left > 0)
+                {
+                    expected[i] = { 0.f, 0.f };
+                    dilation_left--;
+                }
+            }
+        }
+    }
+
+    int invalidated = 0;
+    for (int i = 0; i < size; ++i)
+    {
+        REQUIRE(uv[i].x == expected[i].x);
+        REQUIRE(uv[i].y == expected[i].y);
+        invalidated += uv[i].x == 0.f;
+    }
+    REQUIRE(invalidated > 0);
+    REQUIRE(std::any_of(uv.begin() + (height - 1) * width, uv.end(), [](const float2& t) { return t.x == 0.f && t.y == 0.f; }));
+}
+
+TEST_CASE("Motion transform converts every sample of a batched frame", "[code]")
+{
+    using namespace librealsense;
+
+    frame_source source;
+    source.init(std::shared_ptr<metadata_parser_map>());
+    auto profile = std::make_shared<motion_stream_profile>(platform::stream_profile{ 1, 1, 200, 0 });
+    profile->set_stream_type(RS2_STREAM_GYRO);
+    profile->set_format(RS2_FORMAT_MOTION_XYZ32F);
+
+    // Raw gyro samples, as batched by the HID sensor
+    const uint32_t samples = 5;
+    std::vector<rs2_motion_sample> raw_samples(samples);
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        hid_data raw{};
+        raw.x = short(10 * i);
+        raw.y = short(-5 * int(i));
+        raw.z = 100;
+        memcpy(&raw_samples[i].value, &raw, sizeof(raw));
+        raw_samples[i].timestamp = 10. + 2.5 * i;
+    }
+
+    frame_additional_data data;
+    data.timestamp = raw_samples.front().timestamp;
+    data.motion_samples = samples;
+    auto raw_frame = source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, samples * sizeof(rs2_motion_sample), data, true);
+    REQUIRE(raw_frame);
+    raw_frame->set_stream(profile);
+    memcpy((void*)raw_frame->get_frame_data(), raw_samples.data(), samples * sizeof(rs2_motion_sample));
+
+    gyroscope_transform transform;
+    rs2::frame output;
+    auto on_output = [&output](frame_interface* f) { output = rs2::frame((rs2_frame*)f); };
+    transform.set_output_callback(std::make_shared<internal_frame_callback<decltype(on_output)>>(on_output));
+    transform.invoke(frame_holder(raw_frame));
+
+    REQUIRE(output);
+    auto mf = dynamic_cast<motion_frame*>((frame_interface*)output.get());
+    REQUIRE(mf);
+    REQUIRE(mf->get_samples_count() == samples);
+    REQUIRE(output.get_data_size() == int(samples * sizeof(rs2_motion_sample)));
+
+    // 0.1 deg/sec per unit, converted to rad/sec
+    const float factor = float(deg2rad(0.1));
+    auto result = reinterpret_cast<const rs2_motion_sample*>(output.get_data());
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        REQUIRE(result[i].timestamp == raw_samples[i].timestamp);
+        REQUIRE(result[i].value.x == Approx(10 * i * factor));
+        REQUIRE(result[i].value.y == Approx(-5 * int(i) * factor));
+        REQUIRE(result[i].value.z == Approx(100 * factor));
+    }
+}
+
+TEST_CASE("Frame delivered in a backend buffer holds it until released", "[code]")
+{
+    using namespace librealsense;
+
+    frame_source source;
+    source.init(std::shared_ptr<metadata_parser_map>());
+
+    // The buffer the backend captured to, queued back once the frame is released
+    std::vector<uint8_t> buffer(640 * 480 * 2, 7);
+    int enqueued = 0;
+
+    frame_additional_data data;
+    {
+        frame_holder f(source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, buffer.size(), data, false));
+        REQUIRE(f);
+        f->attach_continuation(frame_continuation([&enqueued]() { ++enqueued; }, buffer.data(), buffer.size()));
+
+        REQUIRE(f->get_frame_data() == buffer.data());
+        REQUIRE(f->get_frame_data_size() == int(buffer.size()));
+        REQUIRE(enqueued == 0);
+    }
+    REQUIRE(enqueued == 1);
+}
+
+namespace
+{
+    class fake_uevent_source : public librealsense::platform::uevent_source
+    {
+    public:
+        void push(const std::string& raw)
+        {
+            librealsense::platform::uevent ev;
+            REQUIRE(librealsense::platform::parse_uevent(raw.data(), raw.size(), ev));
+            std::lock_guard<std::mutex> lock(_mutex);
+            _events.push_back(ev);
+            _cv.notify_all();
+        }
+
+        bool next(librealsense::platform::uevent& ev, int timeout_ms) override
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (!_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() { return !_events.empty(); }))
+                return false;
+            ev = _events.front();
+            _events.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        std::deque<librealsense::platform::uevent> _events;
+    };
+
+    class fake_device_backend : public librealsense::platform::backend
+    {
+    public:
+        std::shared_ptr<librealsense::platform::uvc_device> create_uvc_device(librealsense::platform::uvc_device_info) const override { return nullptr; }
+        std::vector<librealsense::platform::uvc_device_info> query_uvc_devices() const override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++uvc_queries;
+            return uvc_devices;
+        }
+
+        std::shared_ptr<librealsense::platform::command_transfer> create_usb_device(librealsense::platform::usb_device_info) const override { return nullptr; }
+        std::vector<librealsense::platform::usb_device_info> query_usb_devices() const override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++usb_queries;
+            return{};
+        }
+
+        std::shared_ptr<librealsense::platform::hid_device> create_hid_device(librealsense::platform::hid_device_info) const override { return nullptr; }
+        std::vector<librealsense::platform::hid_device_info> query_hid_devices() const override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++hid_queries;
+            return{};
+        }
+
+        std::shared_ptr<librealsense::platform::time_service> create_time_service() const override { return nullptr; }
+        std::shared_ptr<librealsense::platform::device_watcher> create_device_watcher() const override { return nullptr; }
+
+        mutable std::mutex mutex;
+        std::vector<librealsense::platform::uvc_device_info> uvc_devices;
+        mutable int uvc_queries = 0;
+        mutable int usb_queries = 0;
+        mutable int hid_queries = 0;
+    };
+
+    librealsense::platform::uvc_device_info make_uvc_info(const std::string& path)
+    {
+        librealsense::platform::uvc_device_info info;
+        info.id = path;
+        info.vid = 0x8086;
+        info.pid = 0x0b07;
+        info.unique_id = path;
+        info.device_path = path;
+        return info;
+    }
+
+    std::string make_uevent(const std::string& action, const std::string& devpath, const std::vector<std::string>& props)
+    {
+        std::string raw = action + "@" + devpath;
+        raw.push_back('\0');
+        raw += "ACTION=" + action;
+        raw.push_back('\0');
+        raw += "DEVPATH=" + devpath;
+        raw.push_back('\0');
+        for (auto&& prop : props)
+        {
+            raw += prop;
+            raw.push_back('\0');
+        }
+        return raw;
+    }
+}
+
+TEST_CASE("Device watcher reacts to the kernel events of the cameras only", "[code]")
+{
+    using namespace librealsense;
+
+    platform::uevent ev;
+    auto raw = make_uevent("add", "/devices/pci0000:00/usb2/2-1", { "SUBSYSTEM=usb", "DEVTYPE=usb_device", "PRODUCT=8086/b07/5012" });
+    REQUIRE(platform::parse_uevent(raw.data(), raw.size(), ev));
+    REQUIRE(ev.action == "add");
+    REQUIRE(ev.subsystem == "usb");
+    REQUIRE(ev.devpath == "/devices/pci0000:00/usb2/2-1");
+    REQUIRE(uevent_device_watcher::affected_lists(ev) == uevent_device_watcher::usb_list);
+
+    raw = make_uevent("add", "/devices/pci0000:00/usb1/1-4", { "SUBSYSTEM=usb", "DEVTYPE=usb_device", "PRODUCT=46d/c52b/1211" });
+    REQUIRE(platform::parse_uevent(raw.data(), raw.size(), ev));
+    REQUIRE(uevent_device_watcher::affected_lists(ev) == 0);
+
+    std::string garbage = "libudev";
+    REQUIRE_FALSE(platform::parse_uevent(garbage.data(), garbage.size(), ev));
+
+    fake_device_backend backend;
+    backend.uvc_devices = { make_uvc_info("video0") };
+    auto source = std::make_shared<fake_uevent_source>();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::pair<platform::backend_device_group, platform::backend_device_group>> changes;
+
+    uevent_device_watcher watcher(&backend, source);
+    watcher.start([&](platform::backend_device_group old, platform::backend_device_group curr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        changes.push_back(std::make_pair(old, curr));
+        cv.notify_all();
+    });
+
+    // A device of another vendor plugged does not query the devices, even though the list changed
+    {
+        std::lock_guard<std::mutex> lock(backend.mutex);
+        backend.uvc_devices.push_back(make_uvc_info("video2"));
+    }
+    source->push(raw);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        REQUIRE_FALSE(cv.wait_for(lock, std::chrono::milliseconds(500), [&]() { return !changes.empty(); }));
+    }
+    {
+        std::lock_guard<std::mutex> lock(backend.mutex);
+        REQUIRE(backend.uvc_queries == 1);
+    }
+
+    // The video nodes of a camera are coalesced into a single update of the uvc devices alone
+    source->push(make_uevent("add", "/devices/pci0000:00/usb2/2-1/2-1:1.0/video4linux/video2", { "SUBSYSTEM=video4linux" }));
+    source->push(make_uevent("add", "/devices/pci0000:00/usb2/2-1/2-1:1.0/video4linux/video3", { "SUBSYSTEM=video4linux" }));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        REQUIRE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return !changes.empty(); }));
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].first.uvc_devices.size() == 1);
+        REQUIRE(changes[0].second.uvc_devices.size() == 2);
+    }
+    watcher.stop();
+
+    std::lock_guard<std::mutex> lock(backend.mutex);
+    REQUIRE(backend.uvc_queries == 2);
+    REQUIRE(backend.usb_queries == 1);
+    REQUIRE(backend.hid_queries == 1);
+}
+
+#if defined(RS2_USE_LIBUVC_BACKEND) || defined(RS2_USE_ANDROID_BACKEND) || defined(RS2_USE_WINUSB_UVC_BACKEND)
+TEST_CASE("UVC streamer keeps the requests of a few milliseconds of frames in flight", "[code]")
+{
+    using namespace librealsense::platform;
+
+    const uint32_t vga = 640 * 480 * 2, full_hd = 1920 * 1080 * 2;
+
+    // The frames of 30 ms and one more request for the one being resubmitted
+    REQUIRE(uvc_request_depth(vga, 30, 0) == 2);
+    REQUIRE(uvc_request_depth(vga, 90, 0) == 4);
+    REQUIRE(uvc_request_depth(vga, 300, 0) == 10);
+
+    // At most 16 requests
+    REQUIRE(uvc_request_depth(vga, 1000, 0) == 16);
+    REQUIRE(uvc_request_depth(1024, 100000, 0) == 16);
+
+    // At most 64 MB in flight, still a request however large the frames
+    const uint32_t large = 20 * 1024 * 1024;
+    REQUIRE(uvc_request_depth(large, 300, 0) == 3);
+    REQUIRE(uvc_request_depth(100 * 1024 * 1024, 30, 0) == 1);
+    REQUIRE(uvc_request_depth(full_hd, 1000, 0) * (uint64_t(full_hd) + 1024) <= 64 * 1024 * 1024);
+
+    // The configured count is the minimum, above the bounds as well
+    REQUIRE(uvc_request_depth(vga, 30, 4) == 4);
+    REQUIRE(uvc_request_depth(vga, 300, 4) == 10);
+    REQUIRE(uvc_request_depth(vga, 1000, 20) == 20);
+    REQUIRE(uvc_request_depth(large, 300, 5) == 5);
+
+    // Unknown sizes and rates still get a request
+    REQUIRE(uvc_request_depth(0, 0, 0) == 1);
+    REQUIRE(uvc_request_depth(vga, 0, 0) == 1);
+}
+#endif
+
+TEST_CASE("Option cache writes through and refreshes in the background", "[code]")
+{
+    using namespace librealsense;
+
+    float_option laser(option_range{ 0, 360, 30, 150 });
+    float_option preset(option_range{ 0, 3, 1, 0 });
+    std::atomic<int> reads(0);
+    std::atomic<int> writes(0);
+    std::atomic<float> device_laser(150.f);
+    auto read_laser = [&]() { ++reads; return device_laser.load(); };
+
+    // Disabled, every query reads the device
+    option_cache cache(50);
+    REQUIRE(cache.query(&laser, read_laser) == 150.f);
+    REQUIRE(cache.query(&laser, read_laser) == 150.f);
+    REQUIRE(reads == 2);
+
+    cache.enable();
+    REQUIRE(cache.query(&laser, read_laser) == 150.f);
+    REQUIRE(cache.query(&laser, read_laser) == 150.f);
+    REQUIRE(reads == 3);
+
+    // A set is served without reading the device again
+    cache.set(&laser, 60.f, [&]() { ++writes; device_laser = 60.f; });
+    REQUIRE(writes == 1);
+    REQUIRE(cache.query(&laser, read_laser) == 60.f);
+    REQUIRE(reads == 3);
+
+    // A failed set leaves no value behind
+    REQUIRE_THROWS(cache.set(&laser, 90.f, [&]() { throw invalid_value_exception("set failed"); }));
+    REQUIRE(cache.query(&laser, read_laser) == 60.f);
+    REQUIRE(reads == 4);
+
+    // Setting another control drops the value, as the device may have changed it
+    REQUIRE(cache.query(&preset, []() { return 1.f; }) == 1.f);
+    device_laser = 240.f;
+    cache.set(&preset, 2.f, [&]() { ++writes; });
+    REQUIRE(cache.query(&preset, []() { return 0.f; }) == 2.f);
+    REQUIRE(cache.query(&laser, read_laser) == 240.f);
+    REQUIRE(reads == 5);
+
+    // A value changed by the device shows up once the refresh period passed
+    device_laser = 270.f;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE(cache.query(&laser, read_laser) == 240.f);
+    auto refreshed = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (cache.query(&laser, read_laser) != 270.f && std::chrono::steady_clock::now() < refreshed)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(cache.query(&laser, read_laser) == 270.f);
+
+    // Options polled together go stale together, all of them are refreshed
+    std::vector<std::shared_ptr<float_option>> polled;
+    std::vector<std::atomic<float>> device_values(8);
+    for (size_t i = 0; i < device_values.size(); ++i)
+    {
+        polled.push_back(std::make_shared<float_option>(option_range{ 0, 100, 1, 0 }));
+        device_values[i] = float(i);
+        REQUIRE(cache.query(polled[i].get(), [&, i]() { return device_values[i].load(); }) == float(i));
+    }
+    for (size_t i = 0; i < polled.size(); ++i)
+        device_values[i] = float(i + 50);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto all_refreshed = [&]()
+    {
+        bool refreshed = true;
+        for (size_t i = 0; i < polled.size(); ++i)
+            refreshed = cache.query(polled[i].get(), [&, i]() { return device_values[i].load(); }) == float(i + 50) && refreshed;
+        return refreshed;
+    };
+    refreshed = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!all_refreshed() && std::chrono::steady_clock::now() < refreshed)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(all_refreshed());
+
+    // Deferred, the reads the cache cannot serve are skipped, including those of the controls never cached
+    int before = reads;
+    cache.defer_reads(true);
+    REQUIRE(cache.query(&laser, read_laser) == 270.f);
+    REQUIRE(cache.deferred_reads() == 0);
+    cache.query(&preset, []() { return 3.f; }, false);
+    cache.invalidate();
+    cache.query(&laser, read_laser);
+    REQUIRE(cache.deferred_reads() == 2);
+    cache.defer_reads(false);
+    REQUIRE(reads == before);
+    REQUIRE(cache.query(&preset, []() { return 3.f; }, false) == 3.f);
+
+    cache.stop();
+    before = reads;
+    REQUIRE(cache.query(&laser, read_laser) == 270.f);
+    REQUIRE(reads == before + 1);
+}
@@ -92,3 +92,73 @@ TEST_CASE("Extrinsic graph management", "[live][multicam]")
         WARN("TODO: Graph size shall be preserved: init " << init_size << " != final " << end_size);
     }
 }
+
+class graph_test_stream : public stream_interface
+{
+public:
+    int get_stream_index() const override { return 0; }
+    void set_stream_index(int) override {}
+    int get_unique_id() const override { return 0; }
+    void set_unique_id(int) override {}
+    rs2_stream get_stream_type() const override { return RS2_STREAM_ANY; }
+    void set_stream_type(rs2_stream) override {}
+};
+
+static rs2_extrinsics make_translation(float x, float y, float z)
+{
+    auto extr = identity_matrix();
+    extr.translation[0] = x;
+    extr.translation[1] = y;
+    extr.translation[2] = z;
+    return extr;
+}
+
+TEST_CASE("Extrinsic graph lookups follow the changes of the graph", "[code]")
+{
+    extrinsics_graph graph;
+    auto a = std::make_shared<graph_test_stream>();
+    auto b = std::make_shared<graph_test_stream>();
+    auto c = std::make_shared<graph_test_stream>();
+    auto d = std::make_shared<graph_test_stream>();
+
+    int evaluations = 0;
+    auto a_to_b = std::make_shared<lazy<rs2_extrinsics>>([&]() { ++evaluations; return make_translation(1, 0, 0); });
+    graph.register_extrinsics(*a, *b, a_to_b);
+    graph.register_extrinsics(*c, *b, make_translation(0, 2, 0));
+
+    // The path goes through b, against the registered direction of c to b
+    rs2_extrinsics extr;
+    for (int i = 0; i < 3; ++i)
+    {
+        REQUIRE(graph.try_fetch_extrinsics(*a, *c, &extr));
+        require_identity_matrix(extr.rotation);
+        REQUIRE(extr.translation[0] == Approx(1));
+        REQUIRE(extr.translation[1] == Approx(-2));
+        REQUIRE(extr.translation[2] == Approx(0));
+    }
+    REQUIRE(evaluations == 1);
+
+    REQUIRE_FALSE(graph.try_fetch_extrinsics(*a, *d, &extr));
+    REQUIRE_FALSE(graph.try_fetch_extrinsics(*a, *d, &extr));
+
+    // A registration reaches the streams that had no path
+    graph.register_extrinsics(*d, *c, make_translation(0, 0, 3));
+    REQUIRE(graph.try_fetch_extrinsics(*a, *d, &extr));
+    REQUIRE(extr.translation[0] == Approx(1));
+    REQUIRE(extr.translation[1] == Approx(-2));
+    REQUIRE(extr.translation[2] == Approx(-3));
+
+    // An edge that went away with its owner is not used anymore
+    a_to_b.reset();
+    REQUIRE_FALSE(graph.try_fetch_extrinsics(*a, *c, &extr));
+    REQUIRE_FALSE(graph.try_fetch_extrinsics(*a, *d, &extr));
+
+    // A stream destroyed is not mistaken for a new one at the same address
+    graph.register_same_extrinsics(*a, *b);
+    REQUIRE(graph.try_fetch_extrinsics(*a, *c, &extr));
+    REQUIRE(extr.translation[0] == Approx(0));
+    REQUIRE(extr.translation[1] == Approx(-2));
+    a.reset();
+    auto e = std::make_shared<graph_test_stream>();
+    REQUIRE_FALSE(graph.try_fetch_extrinsics(*e, *c, &extr));
+}
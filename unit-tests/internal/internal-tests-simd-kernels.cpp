@@ -0,0 +1,221 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#ifdef __SSSE3__
+#include "./../src/proc/sse/sse-pointcloud.h"
+#include "./../src/proc/sse/sse-align.h"
+
+using namespace librealsense;
+
+namespace
+{
+    // 1280x720 depth aligned to a 1920x1080 color stream
+    struct kernel_inputs
+    {
+        rs2_intrinsics depth_intrin{ 1280, 720, 640.3f, 357.8f, 640.1f, 640.1f, RS2_DISTORTION_BROWN_CONRADY,{ 0, 0, 0, 0, 0 } };
+        rs2_intrinsics color_intrin{ 1920, 1080, 961.2f, 545.7f, 1384.5f, 1382.9f, RS2_DISTORTION_INVERSE_BROWN_CONRADY,{ 0.01f, -0.02f, 0.001f, 0.002f, 0.f } };
+        rs2_extrinsics depth_to_color{ { 0.9999f, 0.0012f, -0.0095f, -0.0012f, 1.f, 0.0011f, 0.0095f, -0.0011f, 0.9999f },{ 0.0147f, 0.0002f, 0.0003f } };
+        float depth_scale = 0.001f;
+
+        std::vector<uint16_t> depth;
+        std::vector<float> map_x, map_y;
+
+        kernel_inputs()
+        {
+            auto size = depth_intrin.width * depth_intrin.height;
+            std::mt19937 gen(1234);
+            std::uniform_int_distribution<int> dist(0, 6000);
+            depth.resize(size);
+            map_x.resize(size);
+            map_y.resize(size);
+            for (int y = 0; y < depth_intrin.height; ++y)
+            {
+                for (int x = 0; x < depth_intrin.width; ++x)
+                {
+                    auto i = y * depth_intrin.width + x;
+                    auto d = dist(gen);
+                    depth[i] = d < 300 ? 0 : d; // Keep a share of invalid pixels
+                    map_x[i] = (x - depth_intrin.ppx) / depth_intrin.fx;
+                    map_y[i] = (y - depth_intrin.ppy) / depth_intrin.fy;
+                }
+            }
+        }
+
+        size_t size() const { return depth.size(); }
+    };
+
+    std::vector<simd_level> supported_levels()
+    {
+        std::vector<simd_level> levels = { simd_level::sse };
+        if (avx2_kernels_available() && cpu_supports(simd_level::avx2)) levels.push_back(simd_level::avx2);
+        if (avx512_kernels_available() && cpu_supports(simd_level::avx512)) levels.push_back(simd_level::avx512);
+        return levels;
+    }
+
+    const char* level_name(simd_level level)
+    {
+        switch (level)
+        {
+        case simd_level::avx2: return "AVX2";
+        case simd_level::avx512: return "AVX-512";
+        default: return "SSE";
+        }
+    }
+
+    void deproject(simd_level level, const kernel_inputs& in, float* points)
+    {
+        switch (level)
+        {
+        case simd_level::avx512: deproject_points_avx512(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), points, in.size()); break;
+        case simd_level::avx2: deproject_points_avx2(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), points, in.size()); break;
+        default: deproject_points_sse(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), points, in.size()); break;
+        }
+    }
+
+    void project(simd_level level, const kernel_inputs& in, const float* points, float* pixels, float* tex)
+    {
+        switch (level)
+        {
+        case simd_level::avx512: project_points_avx512(points, in.size(), in.color_intrin, in.depth_to_color, pixels, tex); break;
+        case simd_level::avx2: project_points_avx2(points, in.size(), in.color_intrin, in.depth_to_color, pixels, tex); break;
+        default: project_points_sse(points, in.size(), in.color_intrin, in.depth_to_color, pixels, tex); break;
+        }
+    }
+
+    void map_pixels(simd_level level, const kernel_inputs& in, int* pixels)
+    {
+        switch (level)
+        {
+        case simd_level::avx512: map_depth_pixels_avx512(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), in.size(), in.color_intrin, in.depth_to_color, true, pixels); break;
+        case simd_level::avx2: map_depth_pixels_avx2(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), in.size(), in.color_intrin, in.depth_to_color, true, pixels); break;
+        default: map_depth_pixels_sse(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), in.size(), in.color_intrin, in.depth_to_color, true, pixels); break;
+        }
+    }
+}
+
+TEST_CASE("Wide pointcloud and align kernels match the SSE kernels", "[code]")
+{
+    kernel_inputs in;
+    auto size = in.size();
+
+    std::vector<float> ref_points(size * 3), ref_pixels(size * 2), ref_tex(size * 2);
+    std::vector<int> ref_map(size * 2);
+    deproject(simd_level::sse, in, ref_points.data());
+    project(simd_level::sse, in, ref_points.data(), ref_pixels.data(), ref_tex.data());
+    map_pixels(simd_level::sse, in, ref_map.data());
+
+    for (auto level : supported_levels())
+    {
+        CAPTURE(level_name(level));
+        std::vector<float> points(size * 3), pixels(size * 2), tex(size * 2);
+        std::vector<int> map(size * 2);
+        deproject(level, in, points.data());
+        project(level, in, ref_points.data(), pixels.data(), tex.data());
+        map_pixels(level, in, map.data());
+
+        REQUIRE(points == ref_points);
+        REQUIRE(pixels == ref_pixels);
+        REQUIRE(tex == ref_tex);
+        REQUIRE(map == ref_map);
+    }
+}
+
+TEST_CASE("Packed vertex conversions", "[code]")
+{
+    REQUIRE(float_to_half(0.f) == 0x0000);
+    REQUIRE(float_to_half(-0.f) == 0x8000);
+    REQUIRE(float_to_half(1.f) == 0x3c00);
+    REQUIRE(float_to_half(-2.f) == 0xc000);
+    REQUIRE(float_to_half(65504.f) == 0x7bff);      // Largest half
+    REQUIRE(float_to_half(65520.f) == 0x7c00);      // Rounds up to infinity
+    REQUIRE(float_to_half(6.103515625e-05f) == 0x0400); // Smallest normal half
+    REQUIRE(float_to_half(5.9604645e-08f) == 0x0001);   // Smallest subnormal half
+    REQUIRE(float_to_half(1.00048828125f) == 0x3c00);   // Ties round to even
+    REQUIRE(float_to_half(1.00146484375f) == 0x3c02);
+
+    REQUIRE(float_to_fixed16(1.2346f, 1000.f) == 1235);
+    REQUIRE(float_to_fixed16(-0.5f, 1000.f) == -500);
+    REQUIRE(float_to_fixed16(40.f, 1000.f) == INT16_MAX);
+    REQUIRE(float_to_fixed16(-40.f, 1000.f) == INT16_MIN);
+
+    REQUIRE(float_to_unorm16(0.f) == 0);
+    REQUIRE(float_to_unorm16(1.f) == 65535);
+    REQUIRE(float_to_unorm16(0.5f) == 32768);
+    REQUIRE(float_to_unorm16(-0.1f) == 0);
+    REQUIRE(float_to_unorm16(1.1f) == 65535);
+}
+
+TEST_CASE("Packed pointcloud kernel matches the float kernels", "[code]")
+{
+    kernel_inputs in;
+    auto size = in.size();
+
+    std::vector<float> points(size * 3), pixels(size * 2), tex(size * 2);
+    deproject_points_sse(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), points.data(), size);
+    project_points_sse(points.data(), size, in.color_intrin, in.depth_to_color, pixels.data(), tex.data());
+
+    // A count off the 8 points blocks exercises the scalar tail as well
+    for (auto count : { size, size - 5 })
+    {
+        for (auto format : { RS2_FORMAT_XYZ16, RS2_FORMAT_XYZ16F })
+        {
+            for (auto map_texture : { true, false })
+            {
+                CAPTURE(count);
+                CAPTURE(format);
+                CAPTURE(map_texture);
+                std::vector<uint16_t> ref_vertices(count * 3), ref_tex(count * 2);
+                pack_points((const float3*)points.data(), map_texture ? (const float2*)tex.data() : nullptr, count, format, 0.001f,
+                    ref_vertices.data(), ref_tex.data());
+
+                std::vector<uint16_t> vertices(count * 3), packed_tex(count * 2);
+                deproject_points_packed_sse(in.depth.data(), in.depth_scale, in.map_x.data(), in.map_y.data(), count, format, 0.001f,
+                    map_texture ? &in.color_intrin : nullptr, map_texture ? &in.depth_to_color : nullptr, vertices.data(), packed_tex.data());
+
+                REQUIRE(vertices == ref_vertices);
+                REQUIRE(packed_tex == ref_tex);
+            }
+        }
+    }
+}
+
+TEST_CASE("Pointcloud and align kernels throughput", "[.][benchmark]")
+{
+    kernel_inputs in;
+    auto size = in.size();
+    const int iterations = 200;
+
+    std::vector<float> points(size * 3), pixels(size * 2), tex(size * 2);
+    std::vector<int> map(size * 2);
+
+    std::cout << "1280x720 depth to 1920x1080 color, " << iterations << " frames" << std::endl;
+    for (auto level : supported_levels())
+    {
+        using namespace std::chrono;
+        double totals[3] = {};
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto t0 = high_resolution_clock::now();
+            deproject(level, in, points.data());
+            auto t1 = high_resolution_clock::now();
+            project(level, in, points.data(), pixels.data(), tex.data());
+            auto t2 = high_resolution_clock::now();
+            map_pixels(level, in, map.data());
+            auto t3 = high_resolution_clock::now();
+            totals[0] += duration<double>(t1 - t0).count();
+            totals[1] += duration<double>(t2 - t1).count();
+            totals[2] += duration<double>(t3 - t2).count();
+        }
+        std::cout << level_name(level)
+            << "\tdeproject: " << iterations / totals[0] << " fps"
+            << "\tproject: " << iterations / totals[1] << " fps"
+            << "\talign map: " << iterations / totals[2] << " fps" << std::endl;
+    }
+}
+#endif // __SSSE3__
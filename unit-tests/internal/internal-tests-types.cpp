@@ -12,6 +12,9 @@
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include "../../common/tiny-profiler.h"
 #include "./../src/environment.h"
+#include "./../src/calibration-cache.h"
+#include <cstdio>
+#include <fstream>
 
 using namespace librealsense;
 using namespace librealsense::platform;
@@ -102,3 +105,56 @@ TEST_CASE("copy_2darray", "[code]")
             REQUIRE(src_double[i][j] != tgt_float[i][j]);
         }
 }
+
+TEST_CASE("Calibration cache reads a table from the device once", "[code]")
+{
+    std::vector<uint8_t> table = { 0x19, 0x00, 0x02, 0x10, 0xaa, 0xbb, 0xcc, 0xdd };
+    int reads = 0;
+    auto read = [&]() { ++reads; return table; };
+
+    calibration_cache disabled;
+    REQUIRE(!disabled.is_enabled());
+    REQUIRE(disabled.get("calibration-25", read) == table);
+    REQUIRE(disabled.get("calibration-25", read) == table);
+    REQUIRE(reads == 2);
+
+    reads = 0;
+    calibration_cache cache(".", "test/serial", "5.12.3.0");
+    REQUIRE(cache.is_enabled());
+    cache.erase("calibration-25");
+
+    REQUIRE(cache.get("calibration-25", read) == table);
+    REQUIRE(calibration_cache(".", "test/serial", "5.12.3.0").get("calibration-25", read) == table);
+    REQUIRE(reads == 1);
+
+    // Another firmware may hold another calibration
+    REQUIRE(calibration_cache(".", "test/serial", "5.12.4.0").get("calibration-25", []() { return std::vector<uint8_t>(); }).empty());
+
+    // A corrupted file is read again from the device
+    {
+        std::fstream f("./test_serial_5.12.3.0_calibration-25.bin", std::ios::in | std::ios::out | std::ios::binary);
+        REQUIRE(f);
+        f.seekp(-1, std::ios::end);
+        f.put(0x00);
+    }
+    REQUIRE(cache.get("calibration-25", read) == table);
+    REQUIRE(reads == 2);
+
+    // So is a file whose header claims a size it does not hold
+    {
+        std::fstream f("./test_serial_5.12.3.0_calibration-25.bin", std::ios::in | std::ios::out | std::ios::binary);
+        REQUIRE(f);
+        uint32_t size = 0xffffffff;
+        f.seekp(sizeof(uint32_t));
+        f.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    REQUIRE(cache.get("calibration-25", read) == table);
+    REQUIRE(reads == 3);
+
+    // A table written to the device is read from it again
+    cache.erase("calibration-25");
+    REQUIRE(cache.get("calibration-25", read) == table);
+    REQUIRE(reads == 4);
+
+    cache.erase("calibration-25");
+}
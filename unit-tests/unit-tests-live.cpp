@@ -5672,3 +5672,152 @@ TEST_CASE("get_sensor_from_frame", "[live][using_pipeline]")
         REQUIRE_NOTHROW(pipe.stop());
     }
 }
+
+// Time from the creation of the context to the first depth frame, split into the enumeration, the device
+// creation and the streaming start. Played back from a recording it measures the library share of the startup
+TEST_CASE("Startup time to first frame", "[live][benchmark]")
+{
+    using namespace std::chrono;
+
+    auto started = steady_clock::now();
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        auto context_created = steady_clock::now();
+
+        rs2::device_list list;
+        REQUIRE_NOTHROW(list = ctx.query_devices());
+        REQUIRE(list.size());
+        auto enumerated = steady_clock::now();
+
+        rs2::device dev;
+        REQUIRE_NOTHROW(dev = list[0]);
+        CAPTURE(dev.get_info(RS2_CAMERA_INFO_NAME));
+        auto depth = dev.first<rs2::depth_sensor>();
+        auto device_created = steady_clock::now();
+
+        auto profiles = depth.get_stream_profiles();
+        auto it = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p)
+        {
+            return p.stream_type() == RS2_STREAM_DEPTH && p.format() == RS2_FORMAT_Z16 && p.is_default();
+        });
+        REQUIRE(it != profiles.end());
+
+        std::mutex m;
+        std::condition_variable cv;
+        bool arrived = false;
+        steady_clock::time_point first_frame;
+
+        REQUIRE_NOTHROW(depth.open(*it));
+        REQUIRE_NOTHROW(depth.start([&](rs2::frame f)
+        {
+            std::lock_guard<std::mutex> lock(m);
+            if (!arrived)
+            {
+                first_frame = steady_clock::now();
+                arrived = true;
+                cv.notify_all();
+            }
+        }));
+
+        {
+            std::unique_lock<std::mutex> lock(m);
+            REQUIRE(cv.wait_for(lock, seconds(10), [&]() { return arrived; }));
+        }
+        REQUIRE_NOTHROW(depth.stop());
+        REQUIRE_NOTHROW(depth.close());
+
+        auto ms = [](steady_clock::time_point from, steady_clock::time_point to)
+        {
+            return duration_cast<duration<double, std::milli>>(to - from).count();
+        };
+        std::cout << "Startup of " << dev.get_info(RS2_CAMERA_INFO_NAME) << ":" << std::endl
+            << "  context     " << ms(started, context_created) << " ms" << std::endl
+            << "  enumeration " << ms(context_created, enumerated) << " ms" << std::endl
+            << "  device      " << ms(enumerated, device_created) << " ms" << std::endl
+            << "  first frame " << ms(device_created, first_frame) << " ms" << std::endl
+            << "  total       " << ms(started, first_frame) << " ms" << std::endl;
+    }
+}
+
+TEST_CASE("Devices created at once match the devices created one by one", "[live][multicam]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        rs2::device_list list;
+        REQUIRE_NOTHROW(list = ctx.query_devices());
+        REQUIRE(list.size());
+
+        std::vector<rs2::device> devices;
+        REQUIRE_NOTHROW(devices = list.create_devices());
+        REQUIRE(devices.size() == list.size());
+
+        for (uint32_t i = 0; i < list.size(); ++i)
+        {
+            auto dev = list[i];
+            CAPTURE(dev.get_info(RS2_CAMERA_INFO_NAME));
+            REQUIRE(std::string(devices[i].get_info(RS2_CAMERA_INFO_NAME)) == dev.get_info(RS2_CAMERA_INFO_NAME));
+            if (dev.supports(RS2_CAMERA_INFO_SERIAL_NUMBER))
+                REQUIRE(std::string(devices[i].get_info(RS2_CAMERA_INFO_SERIAL_NUMBER)) == dev.get_info(RS2_CAMERA_INFO_SERIAL_NUMBER));
+            REQUIRE(devices[i].query_sensors().size() == dev.query_sensors().size());
+        }
+
+        // A list with no devices creates none, rather than failing
+        for (auto line : { RS2_PRODUCT_LINE_NON_INTEL, RS2_PRODUCT_LINE_D400, RS2_PRODUCT_LINE_SR300, RS2_PRODUCT_LINE_L500, RS2_PRODUCT_LINE_T200 })
+        {
+            auto empty = ctx.query_devices(line);
+            if (empty.size())
+                continue;
+            REQUIRE_NOTHROW(devices = empty.create_devices());
+            REQUIRE(devices.empty());
+        }
+    }
+}
+
+TEST_CASE("Sensors list the processing blocks of their open streams", "[live]")
+{
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        rs2::device_list list;
+        REQUIRE_NOTHROW(list = ctx.query_devices());
+        REQUIRE(list.size());
+
+        auto sensor = list[0].query_sensors().front();
+        REQUIRE(sensor.get_processing_blocks().empty());
+
+        auto profiles = sensor.get_stream_profiles();
+        REQUIRE(profiles.size());
+        REQUIRE_NOTHROW(sensor.open(profiles.front()));
+
+        // The blocks producing the open stream, counted while streaming
+        auto blocks = sensor.get_processing_blocks();
+        REQUIRE(blocks.size());
+        for (auto&& block : blocks)
+            block.enable_stats();
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        int frames = 0;
+        REQUIRE_NOTHROW(sensor.start([&](rs2::frame)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++frames;
+            cv.notify_one();
+        }));
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            REQUIRE(cv.wait_for(lock, std::chrono::seconds(10), [&]() { return frames >= 5; }));
+        }
+        REQUIRE_NOTHROW(sensor.stop());
+
+        unsigned long long calls = 0;
+        for (auto&& block : blocks)
+            calls += block.get_stats().calls;
+        REQUIRE(calls >= 5);
+
+        REQUIRE_NOTHROW(sensor.close());
+        REQUIRE(sensor.get_processing_blocks().empty());
+    }
+}
@@ -523,3 +523,73 @@ TEST_CASE("Test point cloud from recording", "[software-device][point-cloud]")
     auto record_block = pointcloud_record_block();
     compare_processed_frames_vs_recorded_frames(record_block, "[pointcloud]_all_combinations_depth_color.bag");
 }
+
+TEST_CASE("Processing batch throughput from recording", "[.][benchmark]")
+{
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "single_depth_color_640x480.bag";
+    REQUIRE(file_exists(filename));
+    auto dev = ctx.load_device(filename);
+    dev.set_real_time(false);
+
+    rs2::syncer sync;
+    std::vector<rs2::sensor> sensors = dev.query_sensors();
+    for (auto s : sensors)
+    {
+        REQUIRE_NOTHROW(s.open(s.get_stream_profiles().front()));
+        REQUIRE_NOTHROW(s.start(sync));
+    }
+
+    rs2::frame depth;
+    while (!depth)
+    {
+        rs2::frameset fs = sync.wait_for_frames();
+        depth = fs.first_or_default(RS2_STREAM_DEPTH);
+    }
+    depth.keep();
+
+    for (auto s : sensors)
+    {
+        s.stop();
+        s.close();
+    }
+
+    // The recorded frame is replayed, the filters copy it as they would a frame of a longer recording
+    const int iterations = 300;
+    std::vector<rs2::frame> frames(iterations, depth);
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    using namespace std::chrono;
+    rs2::spatial_filter spatial;
+    rs2::temporal_filter temporal;
+    rs2::hole_filling_filter hole_filling;
+    rs2::pointcloud pc;
+    rs2::frame expected;
+    auto t0 = high_resolution_clock::now();
+    for (auto&& f : frames)
+        expected = pc.process(hole_filling.process(temporal.process(spatial.process(f))));
+    auto t1 = high_resolution_clock::now();
+
+    rs2::processing_batch batch(threads);
+    batch.add_parallel_stage(std::vector<rs2::spatial_filter>(threads));
+    batch.add_ordered_stage(rs2::temporal_filter());
+    batch.add_parallel_stage(std::vector<rs2::hole_filling_filter>(threads));
+    batch.add_parallel_stage(std::vector<rs2::pointcloud>(threads));
+    auto t2 = high_resolution_clock::now();
+    auto results = batch.process(frames);
+    auto t3 = high_resolution_clock::now();
+
+    REQUIRE(results.size() == frames.size());
+    auto expected_points = expected.as<rs2::points>();
+    auto points = results.back().as<rs2::points>();
+    REQUIRE(points.size() == expected_points.size());
+    REQUIRE(memcmp(points.get_vertices(), expected_points.get_vertices(), points.size() * sizeof(rs2::vertex)) == 0);
+
+    std::cout << "Spatial, temporal, hole filling and point cloud over " << iterations << " frames" << std::endl
+        << "sequential: " << iterations / duration<double>(t1 - t0).count() << " fps" << std::endl
+        << "batch of " << threads << " threads: " << iterations / duration<double>(t3 - t2).count() << " fps" << std::endl;
+}
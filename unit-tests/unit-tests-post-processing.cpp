@@ -268,6 +268,662 @@ TEST_CASE("Post-Processing Filters sequence validation", "[software-device][post
     }
 }
 
+// The fused block is expected to reproduce a chain of the same filters byte by byte, including the temporal filter state
+TEST_CASE("Depth post-processing block matches the filters chain", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+    depth_sensor.add_read_only_option(RS2_OPTION_STEREO_BASELINE, 50.f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    // Two identically configured sets of filters, one applied in turn and one through the fused block
+    auto make_filters = []()
+    {
+        rs2::decimation_filter decimation(2);
+        rs2::spatial_filter spatial;
+        spatial.set_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, 0.7f);
+        spatial.set_option(RS2_OPTION_FILTER_SMOOTH_DELTA, 25.f);
+        spatial.set_option(RS2_OPTION_FILTER_MAGNITUDE, 2.f);
+        rs2::temporal_filter temporal;
+        temporal.set_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, 0.6f);
+        temporal.set_option(RS2_OPTION_FILTER_SMOOTH_DELTA, 15.f);
+        temporal.set_option(RS2_OPTION_HOLES_FILL, 6.f);
+        rs2::hole_filling_filter hole_filling(1);
+
+        std::vector<rs2::filter> filters;
+        filters.push_back(decimation);
+        filters.push_back(rs2::disparity_transform(true));
+        filters.push_back(spatial);
+        filters.push_back(temporal);
+        filters.push_back(rs2::disparity_transform(false));
+        filters.push_back(hole_filling);
+        return filters;
+    };
+    auto chain = make_filters();
+    rs2::depth_post_processing fused(make_filters());
+
+    // The filters must follow the chain order
+    std::vector<rs2::filter> out_of_order;
+    out_of_order.push_back(rs2::spatial_filter());
+    out_of_order.push_back(rs2::decimation_filter());
+    REQUIRE_THROWS(rs2::depth_post_processing{ out_of_order });
+    std::vector<rs2::filter> unsupported;
+    unsupported.push_back(rs2::colorizer());
+    REQUIRE_THROWS(rs2::depth_post_processing{ unsupported });
+
+    std::vector<uint16_t> pixels(width * height);
+    for (int i = 0; i < 5; i++)
+    {
+        // Slanted plane with noise and holes that move between frames
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+            {
+                auto noise = (x * 7 + y * 13 + i * 31) % 17;
+                pixels[y * width + x] = ((x + y + i * 3) % 23 == 0) ? 0 : uint16_t(800 + x * 2 + y + noise);
+            }
+
+        depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+            (rs2_time_t)i, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, i + 1, depth_stream_profile });
+
+        rs2::frameset fset = sync.wait_for_frames();
+        rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+        REQUIRE(depth);
+
+        auto expected = depth;
+        for (auto&& f : chain)
+            expected = f.process(expected);
+        auto result = fused.process(depth);
+
+        auto expected_vf = expected.as<rs2::video_frame>();
+        auto result_vf = result.as<rs2::video_frame>();
+        REQUIRE(result_vf);
+        REQUIRE(result.get_profile().format() == RS2_FORMAT_Z16);
+        REQUIRE(result_vf.get_width() == expected_vf.get_width());
+        REQUIRE(result_vf.get_height() == expected_vf.get_height());
+        REQUIRE(memcmp(result.get_data(), expected.get_data(), expected_vf.get_height() * expected_vf.get_stride_in_bytes()) == 0);
+    }
+}
+
+TEST_CASE("Filters process the frames handed over to them in place", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    std::vector<uint16_t> pixels(width * height);
+    for (int j = 0; j < width * height; j++)
+        pixels[j] = (j % 13 == 0) ? 0 : uint16_t(j % 6000);
+
+    depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+        0, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, 1, depth_stream_profile });
+
+    rs2::frameset fset = sync.wait_for_frames();
+    rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+    REQUIRE(depth);
+
+    rs2::decimation_filter decimation(2);
+    rs2::threshold_filter threshold(0.5f, 4.f);
+    rs2::hole_filling_filter hole_filling;
+
+    // The reference goes through frames that are still referenced by the test, and are left intact
+    auto decimated = decimation.process(depth);
+    auto thresholded = threshold.process(decimated);
+    REQUIRE(thresholded.get() != decimated.get());
+    auto expected = hole_filling.process(thresholded).as<rs2::video_frame>();
+    REQUIRE(expected.get() != thresholded.get());
+
+    // Frames handed over to the filters are processed in place, with the same result
+    auto handed_over = decimation.process(depth);
+    auto handed_over_frame = handed_over.get();
+    auto result = hole_filling.process(threshold.process(std::move(handed_over))).as<rs2::video_frame>();
+    REQUIRE(result.get() == handed_over_frame);
+    REQUIRE(result.get_profile().unique_id() == expected.get_profile().unique_id());
+    REQUIRE(memcmp(result.get_data(), expected.get_data(), expected.get_height() * expected.get_stride_in_bytes()) == 0);
+
+    // Frames referencing external memory are never written to, even once the filter holds their only reference
+    auto original_pixels = pixels;
+    auto depth_frame = depth.get();
+    fset = rs2::frameset();
+    auto copy = threshold.process(std::move(depth));
+    REQUIRE(copy.get() != depth_frame);
+    REQUIRE(pixels == original_pixels);
+}
+
+TEST_CASE("Processing graph runs the blocks by their dependencies", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    // Colorizer and decimation run side by side, hole filling consumes the decimated frame
+    rs2::processing_graph graph(2);
+    auto decimation_node = graph.add(rs2::decimation_filter(2));
+    auto colorizer_node = graph.add(rs2::colorizer());
+    auto hole_filling_node = graph.add(rs2::hole_filling_filter(1), { decimation_node });
+    REQUIRE(decimation_node == 0);
+    REQUIRE(colorizer_node == 1);
+    REQUIRE(hole_filling_node == 2);
+    REQUIRE_THROWS(graph.add(rs2::threshold_filter(), { 3 }));
+
+    rs2::decimation_filter decimation(2);
+    rs2::colorizer colorizer;
+    rs2::hole_filling_filter hole_filling(1);
+
+    std::vector<uint16_t> pixels(width * height);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < width * height; j++)
+            pixels[j] = (j % 11 == i) ? 0 : uint16_t(500 + (j * 7 + i) % 3000);
+
+        depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+            (rs2_time_t)i, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, i + 1, depth_stream_profile });
+
+        rs2::frameset fset = sync.wait_for_frames();
+        rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+        REQUIRE(depth);
+
+        auto expected_depth = hole_filling.process(decimation.process(depth)).as<rs2::video_frame>();
+        auto expected_color = colorizer.process(depth).as<rs2::video_frame>();
+
+        auto result = graph.process(depth).as<rs2::frameset>();
+        REQUIRE(result);
+        REQUIRE(result.size() == 2);
+
+        auto result_depth = result.first(RS2_STREAM_DEPTH, RS2_FORMAT_Z16).as<rs2::video_frame>();
+        REQUIRE(result_depth.get_width() == expected_depth.get_width());
+        REQUIRE(memcmp(result_depth.get_data(), expected_depth.get_data(), expected_depth.get_height() * expected_depth.get_stride_in_bytes()) == 0);
+
+        auto result_color = result.first(RS2_STREAM_DEPTH, RS2_FORMAT_RGB8).as<rs2::video_frame>();
+        REQUIRE(memcmp(result_color.get_data(), expected_color.get_data(), expected_color.get_height() * expected_color.get_stride_in_bytes()) == 0);
+    }
+}
+
+TEST_CASE("Processing batch delivers the frames in order", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2, frames_count = 8;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    std::vector<std::vector<uint16_t>> buffers(frames_count, std::vector<uint16_t>(width * height));
+    std::vector<rs2::frame> frames;
+    for (int i = 0; i < frames_count; i++)
+    {
+        auto& pixels = buffers[i];
+        for (int j = 0; j < width * height; j++)
+            pixels[j] = (j % 11 == i) ? 0 : uint16_t(500 + (j * 7 + i * 131) % 3000);
+
+        depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+            (rs2_time_t)i, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, i + 1, depth_stream_profile });
+
+        rs2::frameset fset = sync.wait_for_frames();
+        rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+        REQUIRE(depth);
+        depth.keep();
+        frames.push_back(depth);
+    }
+
+    // The temporal filter sees the frames in order, the others are replicated
+    rs2::processing_batch batch(4);
+    std::vector<rs2::spatial_filter> spatial(4);
+    std::vector<rs2::hole_filling_filter> hole_filling(2);
+    rs2::temporal_filter temporal;
+    REQUIRE_THROWS(batch.add_parallel_stage(std::vector<rs2::spatial_filter>()));
+    batch.add_parallel_stage(spatial);
+    batch.add_ordered_stage(temporal);
+    batch.add_parallel_stage(hole_filling);
+
+    rs2::spatial_filter ref_spatial;
+    rs2::temporal_filter ref_temporal;
+    rs2::hole_filling_filter ref_hole_filling;
+
+    auto results = batch.process(frames);
+    REQUIRE(results.size() == frames.size());
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        auto expected = ref_hole_filling.process(ref_temporal.process(ref_spatial.process(frames[i]))).as<rs2::video_frame>();
+        auto result = results[i].as<rs2::video_frame>();
+        REQUIRE(result);
+        REQUIRE(result.get_frame_number() == frames[i].get_frame_number());
+        REQUIRE(result.get_width() == expected.get_width());
+        REQUIRE(memcmp(result.get_data(), expected.get_data(), expected.get_height() * expected.get_stride_in_bytes()) == 0);
+    }
+
+    // Invokers racing each other on a single worker, the ordered stage never waits for a frame queued behind it
+    rs2::temporal_filter ordered;
+    {
+        rs2::processing_batch single(1);
+        single.add_ordered_stage(ordered);
+
+        std::mutex mutex;
+        std::vector<unsigned long long> delivered;
+        single.start([&](rs2::frame f)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            delivered.push_back(f.get_frame_number());
+        });
+
+        const int invokers_count = 4;
+        std::vector<std::thread> invokers;
+        for (int t = 0; t < invokers_count; t++)
+            invokers.emplace_back([&]() { for (auto&& f : frames) single.invoke(f); });
+        for (auto&& t : invokers)
+            t.join();
+        single.flush();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(delivered.size() == size_t(invokers_count * frames_count));
+    }
+
+    // The block outlives the batch, its output goes nowhere rather than to the stage that is gone
+    ordered.invoke(frames[0]);
+}
+
+TEST_CASE("Processing blocks report their performance counters", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    std::vector<uint16_t> pixels(width * height);
+    for (int j = 0; j < width * height; j++)
+        pixels[j] = (j % 13 == 0) ? 0 : uint16_t(j % 6000);
+
+    depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+        0, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, 1, depth_stream_profile });
+
+    rs2::frameset fset = sync.wait_for_frames();
+    rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+    REQUIRE(depth);
+
+    // A software sensor delivers its frames as given, without blocks of its own
+    REQUIRE(depth_sensor.get_processing_blocks().empty());
+
+    rs2::decimation_filter decimation(2);
+
+    // Nothing is counted until enabled
+    decimation.process(depth);
+    auto stats = decimation.get_stats();
+    REQUIRE(stats.calls == 0);
+
+    decimation.enable_stats();
+    const int frames = 5;
+    for (int i = 0; i < frames; i++)
+        decimation.process(depth);
+
+    stats = decimation.get_stats();
+    REQUIRE(stats.calls == frames);
+    REQUIRE(stats.frames_dropped == 0);
+    REQUIRE(stats.mean_latency_ms >= 0.f);
+    REQUIRE(stats.p50_latency_ms <= stats.p99_latency_ms);
+
+    // Every output frame allocation is accounted for, the decimated frame holding a quarter of the pixels
+    auto decimated = decimation.process(depth).as<rs2::video_frame>();
+    stats = decimation.get_stats();
+    REQUIRE(stats.allocated_bytes >= (unsigned long long)(frames + 1) * decimated.get_height() * decimated.get_stride_in_bytes());
+
+    decimation.reset_stats();
+    stats = decimation.get_stats();
+    REQUIRE(stats.calls == 0);
+    REQUIRE(stats.allocated_bytes == 0);
+
+    // A block that outputs nothing drops the frame
+    rs2::processing_block sink([](rs2::frame, rs2::frame_source&) {});
+    sink.enable_stats();
+    sink.invoke(depth);
+    REQUIRE(sink.get_stats().frames_dropped == 1);
+
+    decimation.enable_stats(false);
+    decimation.process(depth);
+    REQUIRE(decimation.get_stats().calls == 0);
+}
+
+TEST_CASE("Processing blocks restricted to a region of interest", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    const int width = 320, height = 240, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+
+    std::vector<uint16_t> pixels(width * height);
+    for (int j = 0; j < width * height; j++)
+        pixels[j] = (j % 7 == 0) ? 0 : uint16_t(800 + (j * 13) % 400);
+
+    depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+        0, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, 1, depth_stream_profile });
+
+    rs2::frameset fset = sync.wait_for_frames();
+    rs2::frame depth = fset.first_or_default(RS2_STREAM_DEPTH);
+    REQUIRE(depth);
+
+    // The central quarter of the frame
+    const int roi_x = 80, roi_y = 60, roi_width = 160, roi_height = 120;
+    auto set_roi = [](rs2::processing_block& block, bool crop)
+    {
+        block.set_option(RS2_OPTION_ROI_MIN_X, 0.25f);
+        block.set_option(RS2_OPTION_ROI_MIN_Y, 0.25f);
+        block.set_option(RS2_OPTION_ROI_MAX_X, 0.75f);
+        block.set_option(RS2_OPTION_ROI_MAX_Y, 0.75f);
+        block.set_option(RS2_OPTION_ROI_CROP, crop ? 1.f : 0.f);
+    };
+    auto in_roi = [&](int x, int y) { return x >= roi_x && x < roi_x + roi_width && y >= roi_y && y < roi_y + roi_height; };
+
+    // Bounds are kept ordered
+    rs2::hole_filling_filter ordered;
+    REQUIRE_THROWS(ordered.set_option(RS2_OPTION_ROI_MIN_X, 1.f));
+    ordered.set_option(RS2_OPTION_ROI_MAX_X, 0.5f);
+    REQUIRE_THROWS(ordered.set_option(RS2_OPTION_ROI_MIN_X, 0.5f));
+
+    // Filters keeping the resolution leave the data outside the region as is
+    std::vector<rs2::filter> filters;
+    filters.push_back(rs2::hole_filling_filter(0));
+    filters.push_back(rs2::spatial_filter());
+    for (auto&& filter : filters)
+    {
+        set_roi(filter, false);
+        auto result = filter.process(depth).as<rs2::video_frame>();
+        REQUIRE(result.get_width() == width);
+        REQUIRE(result.get_height() == height);
+
+        set_roi(filter, true);
+        auto cropped = filter.process(depth).as<rs2::video_frame>();
+        REQUIRE(cropped.get_width() == roi_width);
+        REQUIRE(cropped.get_height() == roi_height);
+        auto intrinsics = cropped.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+        REQUIRE(intrinsics.ppx == depth_intrinsics.ppx - roi_x);
+        REQUIRE(intrinsics.ppy == depth_intrinsics.ppy - roi_y);
+
+        auto data = static_cast<const uint16_t*>(result.get_data());
+        auto cropped_data = static_cast<const uint16_t*>(cropped.get_data());
+        int changed = 0;
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+            {
+                auto i = y * width + x;
+                if (in_roi(x, y))
+                {
+                    REQUIRE(data[i] == cropped_data[(y - roi_y) * roi_width + x - roi_x]);
+                    changed += data[i] != pixels[i];
+                }
+                else
+                    REQUIRE(data[i] == pixels[i]);
+            }
+        REQUIRE(changed > 0);
+    }
+
+    // Decimation outputs the decimated region alone, or in place in an empty frame
+    rs2::decimation_filter decimation(2);
+    set_roi(decimation, true);
+    auto decimated_roi = decimation.process(depth).as<rs2::video_frame>();
+    REQUIRE(decimated_roi.get_width() == roi_width / 2);
+    REQUIRE(decimated_roi.get_height() == roi_height / 2);
+
+    set_roi(decimation, false);
+    auto decimated = decimation.process(depth).as<rs2::video_frame>();
+    REQUIRE(decimated.get_width() == width / 2);
+    auto decimated_data = static_cast<const uint16_t*>(decimated.get_data());
+    auto decimated_roi_data = static_cast<const uint16_t*>(decimated_roi.get_data());
+    for (int y = 0; y < height / 2; y++)
+        for (int x = 0; x < width / 2; x++)
+        {
+            auto value = decimated_data[y * decimated.get_width() + x];
+            if (in_roi(x * 2, y * 2))
+                REQUIRE(value == decimated_roi_data[(y - roi_y / 2) * decimated_roi.get_width() + x - roi_x / 2]);
+            else
+                REQUIRE(value == 0);
+        }
+
+    // The point cloud holds the points of the region, the others have no depth
+    rs2::pointcloud pc;
+    auto all_points = pc.calculate(depth);
+    set_roi(pc, true);
+    auto roi_points = pc.calculate(depth);
+    REQUIRE(roi_points.size() == roi_width * roi_height);
+    set_roi(pc, false);
+    auto points = pc.calculate(depth);
+    REQUIRE(points.size() == width * height);
+
+    auto all_vertices = all_points.get_vertices();
+    auto roi_vertices = roi_points.get_vertices();
+    auto vertices = points.get_vertices();
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+        {
+            auto i = y * width + x;
+            if (in_roi(x, y))
+            {
+                auto&& roi_vertex = roi_vertices[(y - roi_y) * roi_width + x - roi_x];
+                REQUIRE(vertices[i].z == roi_vertex.z);
+                REQUIRE(roi_vertex.x == Approx(all_vertices[i].x));
+                REQUIRE(roi_vertex.y == Approx(all_vertices[i].y));
+                REQUIRE(roi_vertex.z == all_vertices[i].z);
+            }
+            else
+                REQUIRE(vertices[i].z == 0.f);
+        }
+}
+
+TEST_CASE("Align restricted to a region of interest", "[software-device][post-processing-filters]")
+{
+    rs2::context ctx;
+
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    // Depth and color share their intrinsics and the viewpoint, every depth pixel lands on the color pixel at its place
+    const int width = 320, height = 240, depth_bpp = 2, color_bpp = 3;
+    rs2_intrinsics intrinsics = { width, height, width / 2.f, height / 2.f, 190.f, 190.f,
+        RS2_DISTORTION_BROWN_CONRADY,{ 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+    auto color_sensor = dev.add_sensor("Color");
+    auto color_stream_profile = color_sensor.add_video_stream({ RS2_STREAM_COLOR, 0, 1, width, height, 30, color_bpp, RS2_FORMAT_RGB8, intrinsics });
+    depth_stream_profile.register_extrinsics_to(color_stream_profile, { { 1,0,0,0,1,0,0,0,1 },{ 0,0,0 } });
+
+    dev.create_matcher(RS2_MATCHER_DLR_C);
+    rs2::syncer sync;
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(sync);
+    color_sensor.open(color_stream_profile);
+    color_sensor.start(sync);
+
+    std::vector<uint16_t> depth_pixels(width * height);
+    std::vector<uint8_t> color_pixels(width * height * color_bpp);
+    for (int j = 0; j < width * height; j++)
+    {
+        depth_pixels[j] = (j % 7 == 0) ? 0 : uint16_t(800 + (j * 13) % 400);
+        for (int c = 0; c < color_bpp; c++)
+            color_pixels[j * color_bpp + c] = uint8_t(1 + (j * 7 + c) % 255);
+    }
+
+    rs2::frameset fset;
+    for (int frame_number = 1; frame_number <= 10 && fset.size() < 2; frame_number++)
+    {
+        depth_sensor.on_video_frame({ depth_pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+            frame_number * 33., RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, frame_number, depth_stream_profile });
+        color_sensor.on_video_frame({ color_pixels.data(), [](void*) {}, width * color_bpp, color_bpp,
+            frame_number * 33., RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, frame_number, color_stream_profile });
+        fset = sync.wait_for_frames();
+    }
+    REQUIRE(fset.first_or_default(RS2_STREAM_DEPTH));
+    REQUIRE(fset.first_or_default(RS2_STREAM_COLOR));
+
+    // The central quarter of the frame
+    const int roi_x = 80, roi_y = 60, roi_width = 160, roi_height = 120;
+    auto set_roi = [](rs2::processing_block& block, bool crop)
+    {
+        block.set_option(RS2_OPTION_ROI_MIN_X, 0.25f);
+        block.set_option(RS2_OPTION_ROI_MIN_Y, 0.25f);
+        block.set_option(RS2_OPTION_ROI_MAX_X, 0.75f);
+        block.set_option(RS2_OPTION_ROI_MAX_Y, 0.75f);
+        block.set_option(RS2_OPTION_ROI_CROP, crop ? 1.f : 0.f);
+    };
+    auto in_roi = [&](int x, int y, int margin) { return x >= roi_x + margin && x < roi_x + roi_width - margin &&
+        y >= roi_y + margin && y < roi_y + roi_height - margin; };
+
+    // Color aligned to the depth of the region, alone or in place in an empty frame
+    rs2::align to_depth(RS2_STREAM_DEPTH);
+    auto all_color = to_depth.process(fset).as<rs2::frameset>().first_or_default(RS2_STREAM_COLOR).as<rs2::video_frame>();
+    set_roi(to_depth, true);
+    auto cropped_color = to_depth.process(fset).as<rs2::frameset>().first_or_default(RS2_STREAM_COLOR).as<rs2::video_frame>();
+    REQUIRE(cropped_color.get_width() == roi_width);
+    REQUIRE(cropped_color.get_height() == roi_height);
+
+    // A region moving over time gets aligned profiles of its own size, also once the first cropped profiles are let go of
+    for (int step = 0; step < 40; step++)
+    {
+        auto max_x = 0.5f + (step % 20 + 1) / 128.f;
+        to_depth.set_option(RS2_OPTION_ROI_MAX_X, max_x);
+        auto moved = to_depth.process(fset).as<rs2::frameset>().first_or_default(RS2_STREAM_COLOR).as<rs2::video_frame>();
+        auto expected_width = int(std::ceil(max_x * width)) - roi_x;
+        REQUIRE(moved.get_width() == expected_width);
+        REQUIRE(moved.get_profile().as<rs2::video_stream_profile>().get_intrinsics().width == expected_width);
+    }
+    to_depth.set_option(RS2_OPTION_ROI_MAX_X, 0.75f);
+
+    set_roi(to_depth, false);
+    auto roi_color = to_depth.process(fset).as<rs2::frameset>().first_or_default(RS2_STREAM_COLOR).as<rs2::video_frame>();
+    REQUIRE(roi_color.get_width() == width);
+    REQUIRE(roi_color.get_height() == height);
+
+    auto all_color_data = static_cast<const uint8_t*>(all_color.get_data());
+    auto cropped_color_data = static_cast<const uint8_t*>(cropped_color.get_data());
+    auto roi_color_data = static_cast<const uint8_t*>(roi_color.get_data());
+    int aligned = 0;
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            for (int c = 0; c < color_bpp; c++)
+            {
+                auto i = (y * width + x) * color_bpp + c;
+                if (in_roi(x, y, 0))
+                {
+                    REQUIRE(roi_color_data[i] == all_color_data[i]);
+                    REQUIRE(roi_color_data[i] == cropped_color_data[((y - roi_y) * roi_width + x - roi_x) * color_bpp + c]);
+                    aligned += roi_color_data[i] != 0;
+                }
+                else
+                    REQUIRE(roi_color_data[i] == 0);
+            }
+    REQUIRE(aligned > 0);
+
+    // Depth of the region aligned to color. Each depth pixel covers the color pixel at its place and the next one,
+    // so the pixels at the border of the region may differ from the whole frame aligned
+    rs2::align to_color(RS2_STREAM_COLOR);
+    auto all_depth = to_color.process(fset).as<rs2::frameset>().get_depth_frame();
+    set_roi(to_color, false);
+    auto roi_depth = to_color.process(fset).as<rs2::frameset>().get_depth_frame();
+    REQUIRE(roi_depth.get_width() == width);
+    REQUIRE(roi_depth.get_height() == height);
+
+    auto all_depth_data = static_cast<const uint16_t*>(all_depth.get_data());
+    auto roi_depth_data = static_cast<const uint16_t*>(roi_depth.get_data());
+    aligned = 0;
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+        {
+            auto i = y * width + x;
+            if (in_roi(x, y, 1))
+            {
+                REQUIRE(roi_depth_data[i] == all_depth_data[i]);
+                aligned += roi_depth_data[i] != 0;
+            }
+            else if (!in_roi(x, y, -1))
+                REQUIRE(roi_depth_data[i] == 0);
+        }
+    REQUIRE(aligned > 0);
+}
+
 TEST_CASE("Post-Processing Filters metadata validation", "[software-device][post-processing-filters]")
 {
     rs2::context ctx;
@@ -90,6 +90,12 @@ namespace Intel.RealSense
         Invi = 26,
 
         /// <summary>Grey-scale image as a bit-packed array. 4 pixel data stream taking 5 bytes.</summary>
-        W10 = 27
+        W10 = 27,
+
+        /// <summary>16-bit fixed point 3D coordinates, in units of the frame vertex scale, with 16-bit normalized texture coordinates.</summary>
+        Xyz16 = 28,
+
+        /// <summary>16-bit half precision floating point 3D coordinates, with 16-bit normalized texture coordinates.</summary>
+        Xyz16f = 29
     }
 }
@@ -199,5 +199,38 @@ namespace Intel.RealSense
 
         /// <summary>Preserve previous map when starting</summary>
         EnableMapPreservation = 62,
+
+        /// <summary>Emit only the valid points of a pointcloud: 0 - all pixels, 1 - valid points, 2 - valid points with their pixel indices</summary>
+        SparseOutput = 63,
+
+        /// <summary>Vertex format of a pointcloud: 0 - XYZ32F, 1 - XYZ16 fixed point, 2 - XYZ16F half precision</summary>
+        VertexFormat = 64,
+
+        /// <summary>Meters per unit of XYZ16 pointcloud vertices</summary>
+        VertexScale = 65,
+
+        /// <summary>Size of the square texel cells the exhaustive occlusion removal of a pointcloud works on</summary>
+        OcclusionDecimation = 66,
+
+        /// <summary>Left edge of the region of interest a processing block computes, as a fraction of the frame width</summary>
+        RoiMinX = 67,
+
+        /// <summary>Top edge of the region of interest a processing block computes, as a fraction of the frame height</summary>
+        RoiMinY = 68,
+
+        /// <summary>Right edge of the region of interest a processing block computes, as a fraction of the frame width</summary>
+        RoiMaxX = 69,
+
+        /// <summary>Bottom edge of the region of interest a processing block computes, as a fraction of the frame height</summary>
+        RoiMaxY = 70,
+
+        /// <summary>Crop the output frame of a processing block to its region of interest</summary>
+        RoiCrop = 71,
+
+        /// <summary>Maximal number of IMU samples delivered per motion frame, 1 delivers every sample in its own frame</summary>
+        MotionBatchSize = 72,
+
+        /// <summary>Maximal time span in milliseconds of the IMU samples of a batched motion frame, 0 for no time limit</summary>
+        MotionBatchPeriod = 73,
     }
 }